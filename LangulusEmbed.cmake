@@ -0,0 +1,97 @@
+# Embed files into literal_t at build time                                      
+#                                                                               
+#   langulus_embed_literal(<target> NAME <identifier> FILE <path>               
+#       [NAMESPACE <namespace>] [TYPE <char|char8_t>])                          
+#                                                                               
+# Generates <identifier>.hpp for the target to include, which defines           
+# <namespace>::<identifier> as a constexpr literal_t with the file's contents.  
+# Uses #embed when the compiler supports it, otherwise the bytes are written    
+# into the header, which is regenerated whenever the file changes               
+
+# Wraps the bytes in a header, shared by both ways of embedding. A terminator   
+# follows the bytes, so that even an empty file makes an array                  
+function(langulus_embed_header OUTPUT INPUT NAME NAMESPACE TYPE BYTES)
+    file(CONFIGURE OUTPUT "${OUTPUT}" @ONLY CONTENT "\
+/// Generated by langulus_embed_literal from ${INPUT}, don't edit
+#pragma once
+#include <Langulus/Literal/Embed.hpp>
+
+namespace ${NAMESPACE}
+{
+   inline constexpr unsigned char ${NAME}_bytes[] = {
+${BYTES}
+   };
+
+   inline constexpr auto ${NAME} = ::Langulus::literal_from_terminated_bytes<${TYPE}>(${NAME}_bytes);
+}
+")
+endfunction()
+
+# Script mode - write the header with the file's bytes in it                    
+if (CMAKE_SCRIPT_MODE_FILE)
+    file(READ "${INPUT}" BYTES HEX)
+    string(APPEND BYTES "00")
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${BYTES}")
+    string(REPEAT "0x[0-9a-f][0-9a-f]," 16 LINE)
+    string(REGEX REPLACE "(${LINE})" "\\1\n      " BYTES "${BYTES}")
+    langulus_embed_header("${OUTPUT}" "${INPUT}" "${NAME}" "${NAMESPACE}" "${TYPE}" "      ${BYTES}")
+    return()
+endif()
+
+include(CheckCXXSourceCompiles)
+
+function(langulus_embed_literal TARGET)
+    cmake_parse_arguments(PARSE_ARGV 1 arg "" "NAME;FILE;NAMESPACE;TYPE" "")
+    if (NOT arg_NAME OR NOT arg_FILE)
+        message(FATAL_ERROR "langulus_embed_literal requires NAME and FILE")
+    endif()
+    if (NOT arg_NAMESPACE)
+        set(arg_NAMESPACE "Langulus::Embedded")
+    endif()
+    if (NOT arg_TYPE)
+        set(arg_TYPE "char")
+    endif()
+
+    # Check once per build tree, if #embed is available                         
+    if (NOT DEFINED LANGULUS_EMBED_SUPPORTED)
+        set(CMAKE_REQUIRED_QUIET ON)
+        check_cxx_source_compiles("
+            #ifndef __has_embed
+                #error #embed is not supported
+            #endif
+            int main() {}
+        " LANGULUS_EMBED_SUPPORTED)
+    endif()
+
+    cmake_path(ABSOLUTE_PATH arg_FILE BASE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" OUTPUT_VARIABLE INPUT)
+    set(DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/LangulusEmbed/${TARGET}")
+    set(OUTPUT "${DIRECTORY}/${arg_NAME}.hpp")
+
+    if (LANGULUS_EMBED_SUPPORTED)
+        # The compiler reads the file, and tracks it as a dependency            
+        langulus_embed_header("${OUTPUT}" "${INPUT}" "${arg_NAME}" "${arg_NAMESPACE}" "${arg_TYPE}" "\
+   #ifdef __clang__
+      #pragma clang diagnostic push
+      #pragma clang diagnostic ignored \"-Wc23-extensions\"
+   #endif
+      #embed \"${INPUT}\" suffix(,)
+      0
+   #ifdef __clang__
+      #pragma clang diagnostic pop
+   #endif")
+    else()
+        add_custom_command(
+            OUTPUT  "${OUTPUT}"
+            COMMAND ${CMAKE_COMMAND}
+                "-DINPUT=${INPUT}" "-DOUTPUT=${OUTPUT}" "-DNAME=${arg_NAME}"
+                "-DNAMESPACE=${arg_NAMESPACE}" "-DTYPE=${arg_TYPE}"
+                -P "${CMAKE_CURRENT_FUNCTION_LIST_FILE}"
+            DEPENDS "${INPUT}" "${CMAKE_CURRENT_FUNCTION_LIST_FILE}"
+            COMMENT "Embedding ${arg_FILE} as ${arg_NAMESPACE}::${arg_NAME}"
+            VERBATIM
+        )
+        target_sources(${TARGET} PRIVATE "${OUTPUT}")
+    endif()
+
+    target_include_directories(${TARGET} PRIVATE "${DIRECTORY}")
+endfunction()
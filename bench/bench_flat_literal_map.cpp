@@ -0,0 +1,80 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/FlatMap.hpp>
+#include <random>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   using Key = literal_t<char, 16>;
+   using Map = flat_literal_map<16, uint64_t>;
+
+   /// Random lowercase keys, all unique in practice                          
+   ::std::vector<Key> RandomKeys(size_t count, uint64_t seed) {
+      ::std::mt19937_64 rng {seed};
+      ::std::vector<Key> result(count);
+      for (auto& s : result) {
+         const size_t length = 8 + rng() % 9;
+         for (size_t i = 0; i < length; ++i)
+            s._data[i] = static_cast<char>('a' + rng() % 26);
+      }
+      return result;
+   }
+
+   /// Looks up random keys - 'hits' percent of them present - in a table     
+   /// of the given size, one by one and batched                              
+   void BenchmarkLookups(size_t tableSize, unsigned hits) {
+      const auto present = RandomKeys(tableSize, 1);
+      Map map;
+      map.reserve(tableSize);
+      for (size_t i = 0; i < present.size(); ++i)
+         map.try_emplace(present[i], i);
+
+      const auto absent = RandomKeys(1 << 16, 2);
+      ::std::mt19937_64 rng {3};
+      ::std::vector<Key> queries(1 << 16);
+      for (size_t i = 0; i < queries.size(); ++i) {
+         queries[i] = rng() % 100 < hits
+            ? present[rng() % present.size()] : absent[i];
+      }
+
+      ::std::vector<Map::const_iterator> found(queries.size());
+      const auto& constant = map;
+
+      BENCHMARK("find, one by one") {
+         for (size_t i = 0; i < queries.size(); ++i)
+            found[i] = constant.find(queries[i]);
+         return found.back();
+      };
+
+      BENCHMARK("find_batch") {
+         constant.find_batch(queries, found);
+         return found.back();
+      };
+   }
+}
+
+
+TEST_CASE("Batched lookups", "[map]") {
+   // From fitting in L2 to way past any L3, 32 bytes per slot          
+   for (size_t tableSize : {1 << 12, 1 << 16, 1 << 20, 1 << 23}) {
+      for (unsigned hits : {100u, 50u}) {
+         DYNAMIC_SECTION(tableSize << " keys, " << hits << "% hits") {
+            BenchmarkLookups(tableSize, hits);
+         }
+      }
+   }
+}
+
+/// Needs about 2 GiB of memory, so it's opt-in                               
+TEST_CASE("Batched lookups in 2^26 keys", "[.][map][huge]") {
+   BenchmarkLookups(1 << 26, 100);
+}
@@ -0,0 +1,36 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/HashBatch.hpp>
+#include <random>
+#include <vector>
+
+using namespace Langulus;
+
+
+TEMPLATE_TEST_CASE_SIG("Hashing literals", "[hash]", ((size_t N), N), 8, 16, 32, 64) {
+   ::std::mt19937_64 rng {N};
+   ::std::vector<literal_t<char, N>> keys(1 << 16);
+   for (auto& s : keys) {
+      const size_t length = 1 + rng() % N;
+      for (size_t i = 0; i < length; ++i)
+         s._data[i] = static_cast<char>('a' + rng() % 26);
+   }
+   ::std::vector<uint64_t> hashes(keys.size());
+
+   BENCHMARK("literal_t::hash() one by one") {
+      for (size_t i = 0; i < keys.size(); ++i)
+         hashes[i] = keys[i].hash();
+      return hashes.back();
+   };
+
+   BENCHMARK("hash_batch") {
+      hash_batch(keys, hashes);
+      return hashes.back();
+   };
+}
@@ -0,0 +1,97 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Interner.hpp>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   /// The usual alternative - a map behind a reader-writer lock              
+   class LockedInterner {
+      ::std::shared_mutex _mutex;
+      ::std::unordered_map<::std::string, size_t> _map;
+
+   public:
+      size_t Intern(::std::string_view s) {
+         {
+            ::std::shared_lock lock {_mutex};
+            if (auto found = _map.find(::std::string {s}); found != _map.end())
+               return found->second;
+         }
+         ::std::unique_lock lock {_mutex};
+         return _map.try_emplace(::std::string {s}, _map.size()).first->second;
+      }
+   };
+
+   /// Each thread interns 'ops' strings, mostly ones that are already in,    
+   /// and every hundredth is new                                             
+   template<class F>
+   void RunThreads(unsigned threads, size_t ops, const ::std::vector<::std::string>& known, F&& intern) {
+      ::std::atomic<size_t> sink = 0;
+      ::std::vector<::std::jthread> pool;
+      for (unsigned t = 0; t < threads; ++t) {
+         pool.emplace_back([&, t] {
+            size_t sum = 0;
+            ::std::string fresh;
+            for (size_t i = 0; i < ops; ++i) {
+               if (i % 100 == 99) {
+                  // Made unique across runs with whatever sink holds   
+                  fresh = "fresh." + ::std::to_string(t) + "." + ::std::to_string(i)
+                        + "." + ::std::to_string(sink.load(::std::memory_order_relaxed));
+                  sum += intern(fresh);
+               }
+               else sum += intern(known[(i * 31 + t * 1009) % known.size()]);
+            }
+            sink += sum;
+         });
+      }
+   }
+}
+
+
+TEST_CASE("Interning under contention", "[interner]") {
+   ::std::vector<::std::string> known;
+   for (int i = 0; i < 10000; ++i)
+      known.push_back("topic.market." + ::std::to_string(i));
+   for (auto& s : known)
+      intern(s);
+
+   LockedInterner locked;
+   for (auto& s : known)
+      locked.Intern(s);
+
+   constexpr size_t Ops = 1 << 16;
+   for (unsigned threads : {1u, 8u, 64u}) {
+      DYNAMIC_SECTION(threads << " threads, " << Ops << " strings each, 99% already interned") {
+         BENCHMARK("intern") {
+            RunThreads(threads, Ops, known, [](::std::string_view s) {
+               return intern(s).id();
+            });
+         };
+
+         BENCHMARK("find_interned") {
+            RunThreads(threads, Ops, known, [](::std::string_view s) {
+               return find_interned(s).id();
+            });
+         };
+
+         BENCHMARK("shared_mutex and unordered_map") {
+            RunThreads(threads, Ops, known, [&locked](::std::string_view s) {
+               return locked.Intern(s);
+            });
+         };
+      }
+   }
+}
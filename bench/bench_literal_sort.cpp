@@ -0,0 +1,82 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Sort.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Ticker-like keys - uppercase letters and digits, of random length      
+   template<size_t N>
+   ::std::vector<literal_t<char, N>> RandomKeys(size_t count) {
+      ::std::mt19937_64 rng {count};
+      ::std::vector<literal_t<char, N>> result(count);
+      for (auto& s : result) {
+         const size_t length = 1 + rng() % N;
+         for (size_t i = 0; i < length; ++i)
+            s._data[i] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"[rng() % 36];
+      }
+      return result;
+   }
+
+   template<size_t N>
+   void BenchmarkSorting(size_t count) {
+      const auto source = RandomKeys<N>(count);
+      ::std::vector<literal_t<char, N>> data;
+      data.reserve(count);
+
+      BENCHMARK("copy (baseline for the rest)") {
+         data = source;
+         return data.size();
+      };
+
+      BENCHMARK("std::sort with operator <=>") {
+         data = source;
+         ::std::sort(data.begin(), data.end(), [](auto& a, auto& b) {
+            return (a <=> b) < 0;
+         });
+         return data.size();
+      };
+
+      BENCHMARK("radix_sort") {
+         data = source;
+         radix_sort(data);
+         return data.size();
+      };
+
+      BENCHMARK("parallel_radix_sort") {
+         data = source;
+         parallel_radix_sort(data);
+         return data.size();
+      };
+
+      radix_sort(data);
+      const auto key = source[count / 2];
+      BENCHMARK("equal_range") {
+         return equal_range(data, key).size();
+      };
+   }
+}
+
+
+TEMPLATE_TEST_CASE_SIG("Sorting literals", "[sort]", ((size_t N), N), 16, 32) {
+   for (size_t count : {1'000'000, 10'000'000}) {
+      DYNAMIC_SECTION(count << " literal_t<char, " << N << ">") {
+         BenchmarkSorting<N>(count);
+      }
+   }
+}
+
+/// Needs about 10 GiB of memory for literal_t<char, 32>, so it's opt-in      
+TEMPLATE_TEST_CASE_SIG("Sorting 10^8 literals", "[.][sort][huge]", ((size_t N), N), 16, 32) {
+   BenchmarkSorting<N>(100'000'000);
+}
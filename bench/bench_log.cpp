@@ -0,0 +1,115 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Log.hpp>
+#include <cstdio>
+
+using namespace Langulus;
+
+namespace
+{
+   const auto LogPath = ::std::filesystem::temp_directory_path() / "langulus_bench_log.bin";
+   const auto TextPath = ::std::filesystem::temp_directory_path() / "langulus_bench_log.txt";
+
+   ///                                                                        
+   /// The usual synchronous logger, like spdlog's - the caller formats the   
+   /// whole line, with a timestamp, and writes it into a shared file         
+   ///                                                                        
+   class SyncLogger {
+      ::std::FILE* _file;
+      ::std::mutex _mutex;
+      ::std::string _line;
+
+   public:
+      SyncLogger() : _file {::std::fopen(TextPath.string().c_str(), "wb")} {}
+      ~SyncLogger() { ::std::fclose(_file); }
+
+      void Log(int user, const char* address) {
+         char buffer[256];
+         const auto now = ::std::chrono::system_clock::now().time_since_epoch()
+            / ::std::chrono::nanoseconds {1};
+         ::std::scoped_lock lock {_mutex};
+         _line.clear();
+         Inner::LogTime(_line, now);
+         const auto length = ::std::snprintf(buffer, sizeof(buffer),
+            "user %d failed login from %s\n", user, address);
+         _line.append(buffer, length);
+         ::std::fwrite(_line.data(), 1, _line.size(), _file);
+      }
+   };
+
+   /// Time each call on its own, and print the percentiles                   
+   template<class F>
+   void Latencies(const char* name, F&& call) {
+      constexpr size_t Calls = 200000;
+      ::std::vector<int64_t> times(Calls);
+      for (size_t i = 0; i < Calls; ++i) {
+         const auto begin = ::std::chrono::steady_clock::now();
+         call(static_cast<int>(i));
+         times[i] = (::std::chrono::steady_clock::now() - begin) / ::std::chrono::nanoseconds {1};
+      }
+
+      ::std::ranges::sort(times);
+      ::std::printf("%-36s p50 %6lld ns   p99 %6lld ns   p99.9 %7lld ns   max %8lld ns\n", name,
+         static_cast<long long>(times[Calls / 2]),
+         static_cast<long long>(times[Calls * 99 / 100]),
+         static_cast<long long>(times[Calls * 999 / 1000]),
+         static_cast<long long>(times.back()));
+   }
+}
+
+
+TEST_CASE("Logging throughput", "[log]") {
+   // Per 1000 messages, so divide by 1000 for the cost of one          
+   {
+      SyncLogger logger;
+      BENCHMARK("1000 messages, formatted synchronously") {
+         for (int i = 0; i < 1000; ++i)
+            logger.Log(i, "10.0.0.1");
+      };
+   }
+
+   {
+      log_recorder recorder {LogPath};
+      BENCHMARK("1000 messages, log_recorder") {
+         for (int i = 0; i < 1000; ++i)
+            log<"user {} failed login from {}">(i, "10.0.0.1");
+      };
+   }
+
+   {
+      ::std::ofstream file {TextPath, ::std::ios::binary};
+      log_writer writer {file};
+      BENCHMARK("1000 messages, log_writer") {
+         for (int i = 0; i < 1000; ++i)
+            log<"user {} failed login from {}">(i, "10.0.0.1");
+      };
+   }
+
+   ::std::filesystem::remove(LogPath);
+   ::std::filesystem::remove(TextPath);
+}
+
+TEST_CASE("Logging latency", "[log]") {
+   {
+      SyncLogger logger;
+      Latencies("formatted synchronously", [&](int i) {
+         logger.Log(i, "10.0.0.1");
+      });
+   }
+
+   {
+      log_recorder recorder {LogPath};
+      Latencies("log_recorder", [](int i) {
+         log<"user {} failed login from {}">(i, "10.0.0.1");
+      });
+   }
+
+   ::std::filesystem::remove(LogPath);
+   ::std::filesystem::remove(TextPath);
+}
@@ -0,0 +1,30 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Trace.hpp>
+
+using namespace Langulus;
+
+
+TEST_CASE("Tracing overhead", "[trace]") {
+   // Per 1000 scopes, so divide by 1000 for the overhead of one        
+   BENCHMARK("1000 scopes, no trace file open") {
+      for (int i = 0; i < 1000; ++i)
+         trace_scope<"bench.scope"> scope;
+   };
+
+   const auto path = ::std::filesystem::temp_directory_path() / "langulus_bench_trace.json";
+   {
+      trace_file file {path, ::std::chrono::milliseconds {10}};
+      BENCHMARK("1000 scopes, while tracing") {
+         for (int i = 0; i < 1000; ++i)
+            trace_scope<"bench.scope"> scope;
+      };
+   }
+   ::std::filesystem::remove(path);
+}
@@ -0,0 +1,78 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Binary size benchmark - a synthetic app that runs the runtime members of  
+/// every character type at eight capacities, and compares each of those      
+/// against all the others of the same character type - 40 literal_t types    
+/// and 320 operator == specializations. Build it in release, and compare     
+/// its size, and `perf stat -e instructions,L1-icache-load-misses` of        
+/// running it, e.g. with 100000 iterations, between commits                  
+///                                                                           
+#include <Langulus/Literal.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Capacities are powers of two, all big enough to skip packed paths      
+   constexpr size_t Capacities = 8;
+
+   template<size_t I>
+   constexpr size_t Capacity = size_t {32} << I;
+
+   /// Make a literal with 'length' characters, that the compiler can't see   
+   template<class T, size_t N>
+   literal_t<T, N> Make(size_t length, unsigned seed) {
+      literal_t<T, N> result;
+      for (size_t i = 0; i < length and i < N; ++i)
+         result.data()[i] = static_cast<T>('a' + (seed + i) % 26);
+      return result;
+   }
+
+   /// Everything that used to be generated once per capacity                 
+   template<class T, size_t N, size_t...I>
+   uint64_t Work(unsigned seed, ::std::index_sequence<I...>) {
+      const auto lhs = Make<T, N>(N / 2 + seed % (N / 2), seed);
+      uint64_t result = lhs.size() + lhs.hash();
+      result += lhs.find(static_cast<T>('a' + seed % 26));
+      result += lhs.substr(seed % 7, N / 4).size();
+      result += static_cast<uint64_t>(lhs.compare(lhs.substr(1)));
+
+      auto tail = Make<T, N>(N / 4, seed);
+      tail += lhs.substr(0, N / 4);
+      result += tail.size();
+
+      // Against every capacity of the same character type              
+      result += ((lhs == Make<T, Capacity<I>>(N / 2, seed)) + ...);
+      return result;
+   }
+
+   template<class T, size_t...I>
+   uint64_t WorkAll(unsigned seed, ::std::index_sequence<I...> all) {
+      return (Work<T, Capacity<I>>(seed, all) + ...);
+   }
+}
+
+int main(int argc, char* argv[]) {
+   const unsigned iterations = argc > 1 ? static_cast<unsigned>(::std::atoi(argv[1])) : 1000;
+   constexpr auto all = ::std::make_index_sequence<Capacities> {};
+
+   uint64_t result = 0;
+   for (unsigned i = 0; i < iterations; ++i) {
+      result += WorkAll<char>(i, all);
+      result += WorkAll<wchar_t>(i, all);
+      result += WorkAll<char8_t>(i, all);
+      result += WorkAll<char16_t>(i, all);
+      result += WorkAll<char32_t>(i, all);
+   }
+
+   ::std::printf("%llu\n", static_cast<unsigned long long>(result));
+   return 0;
+}
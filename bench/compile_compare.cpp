@@ -0,0 +1,65 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Compile-time benchmark - there's nothing to run, time building it instead 
+/// with different LANGULUS_BENCH_COMPARE_SIZE. Every check compares literals 
+/// of different capacities and character types with each other, and with     
+/// views and arrays, so nearly all of its build time is spent resolving      
+/// comparison operators                                                      
+///                                                                           
+#include <Langulus/Literal.hpp>
+
+#ifndef LANGULUS_BENCH_COMPARE_SIZE
+   #define LANGULUS_BENCH_COMPARE_SIZE 512
+#endif
+
+using namespace Langulus;
+
+namespace
+{
+   constexpr size_t Size = LANGULUS_BENCH_COMPARE_SIZE;
+
+   /// Names of the form "f0", "f1", ..., with capacities from 4 to 128       
+   template<class T, size_t I>
+   consteval auto Numbered() {
+      literal_t<T, (size_t {4} << (I % 6))> name {};
+      name._data[0] = static_cast<T>('f');
+      name._data[1] = static_cast<T>('0' + I % 10);
+      name._data[2] = static_cast<T>('a' + I / 10 % 26);
+      return name;
+   }
+
+   template<class T, size_t I>
+   consteval bool Check() {
+      constexpr auto a = Numbered<T, I>();
+      constexpr auto b = Numbered<T, I + 1>();
+      constexpr auto c = Numbered<T, I * 7 + 3>();
+      constexpr T array[] {static_cast<T>('f'), static_cast<T>('0' + I % 10), 0};
+      const ::std::basic_string_view<T> view = a;
+
+      return a == a and a != b and a == view and view == a
+         and a != array and array != b and (a < b) != (b < a)
+         and (a <=> c) == (view <=> c) and (c >= view) == (c >= a)
+         and literal_t {5} == literal_t {5} and literal_t {} == literal_t {""};
+   }
+
+   template<size_t...I>
+   consteval bool Benchmark(::std::index_sequence<I...>) {
+      // Each check is a constant expression of its own, to keep the steps low
+      constexpr bool checks[] {true,
+         ::std::bool_constant<Check<char, I>()>::value...,
+         ::std::bool_constant<Check<char16_t, I>()>::value...
+      };
+      for (auto check : checks) {
+         if (not check)
+            return false;
+      }
+      return true;
+   }
+
+   static_assert(Benchmark(::std::make_index_sequence<Size> {}));
+}
@@ -0,0 +1,32 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Compile-time benchmark - there's nothing to run, time building it instead 
+/// as is, and with LANGULUS_BENCH_FULL to include all of <Langulus/Literal.hpp>
+/// instead of just the core. It's the most common TU - literal_t is only     
+/// used as a template argument, and compared                                 
+///                                                                           
+#ifdef LANGULUS_BENCH_FULL
+   #include <Langulus/Literal.hpp>
+#else
+   #include <Langulus/Literal/Core.hpp>
+#endif
+
+using namespace Langulus;
+
+namespace
+{
+   template<literal_t NAME>
+   struct Component {
+      static constexpr auto name = NAME;
+   };
+
+   static_assert(Component<"pos">::name == "pos");
+   static_assert(Component<"pos">::name != Component<"vel">::name);
+   static_assert(Component<u"mass">::name == u"mass");
+   static_assert(Component<"">::name.empty());
+}
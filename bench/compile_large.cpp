@@ -0,0 +1,38 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Compile-time benchmark - there's nothing to run, build it instead with    
+/// different LANGULUS_BENCH_LARGE_SIZE. Clang caps constant-evaluated arrays 
+/// at -fconstexpr-steps elements, so with its defaults the size can go up to 
+/// 512 KiB - 1, and 1 MiB needs that limit raised. Measure time and peak     
+/// memory of building it, e.g. with /usr/bin/time -v on the compiler command 
+///                                                                           
+#include <Langulus/Literal.hpp>
+#include "large.hpp"
+
+using namespace Langulus;
+using Embedded::large;
+
+namespace
+{
+   constexpr size_t Size = LANGULUS_BENCH_LARGE_SIZE;
+
+   static_assert(large.size() == Size);
+   static_assert(large == large);
+   static_assert(large.hash() != HashLiteral(::std::string_view {}));
+
+   /// Half of the file, appended to itself                                   
+   constexpr auto half = large.substr(Size / 2);
+   static_assert(half.size() == Size - Size / 2);
+
+   constexpr auto twice = [] {
+      auto result = half;
+      result += half;
+      return result;
+   }();
+   static_assert(twice.size() == half.size() * 2);
+}
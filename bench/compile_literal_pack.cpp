@@ -0,0 +1,69 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Compile-time benchmark - there's nothing to run, time building it instead 
+/// with different LANGULUS_BENCH_PACK_SIZE, and with LANGULUS_BENCH_RECURSIVE
+/// to compare against the usual recursive implementation                     
+///                                                                           
+#include <Langulus/Literal/Pack.hpp>
+
+#ifndef LANGULUS_BENCH_PACK_SIZE
+   #define LANGULUS_BENCH_PACK_SIZE 1024
+#endif
+
+using namespace Langulus;
+
+namespace
+{
+   constexpr size_t Size = LANGULUS_BENCH_PACK_SIZE;
+
+   template<size_t I>
+   consteval literal_t<char, 8> Numbered() {
+      literal_t<char, 8> name {"f"};
+      size_t digits = 1;
+      for (auto i = I; i >= 10; i /= 10)
+         ++digits;
+      for (auto i = I, d = digits; d; i /= 10, --d)
+         name._data[d] = static_cast<char>('0' + i % 10);
+      return name;
+   }
+
+#ifdef LANGULUS_BENCH_RECURSIVE
+   /// One instantiation per element skipped, per query                       
+   template<literal_t NAME, literal_t...V>
+   struct RecursiveIndexOf : ::std::integral_constant<size_t, 0> {};
+
+   template<literal_t NAME, literal_t HEAD, literal_t...TAIL>
+   struct RecursiveIndexOf<NAME, HEAD, TAIL...> : ::std::integral_constant<size_t,
+      NAME == HEAD ? 0 : 1 + RecursiveIndexOf<NAME, TAIL...>::value> {};
+
+   template<literal_t...V>
+   struct Queries {
+      template<size_t...Q>
+      static consteval size_t Run(::std::index_sequence<Q...>) {
+         return (RecursiveIndexOf<Numbered<Q * (Size / 64)>(), V...>::value + ...);
+      }
+   };
+#else
+   template<literal_t...V>
+   struct Queries {
+      template<size_t...Q>
+      static consteval size_t Run(::std::index_sequence<Q...>) {
+         static_assert(pack_unique<V...>);
+         static_assert(::std::same_as<pack_sort<V...>, pack_sort<V...>>);
+         return (pack_index_of<Numbered<Q * (Size / 64)>(), V...> + ...);
+      }
+   };
+#endif
+
+   template<size_t...I>
+   consteval size_t Benchmark(::std::index_sequence<I...>) {
+      return Queries<Numbered<I>()...>::Run(::std::make_index_sequence<64> {});
+   }
+
+   static_assert(Benchmark(::std::make_index_sequence<Size> {}) == (Size / 64) * (63 * 64 / 2));
+}
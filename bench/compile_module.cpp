@@ -0,0 +1,41 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Compile-time benchmark - there's nothing to run, time building it instead 
+/// as is, and with LANGULUS_BENCH_IMPORT to get literal_t from the module.   
+/// It's the typical TU - a few literals, compared, searched and joined, so   
+/// nearly all of its build time is spent parsing the library                 
+///                                                                           
+#ifdef LANGULUS_BENCH_IMPORT
+   import Langulus.Literal;
+#else
+   #include <Langulus/Literal.hpp>
+#endif
+
+using namespace Langulus;
+
+namespace
+{
+   template<literal_t NAME>
+   struct Component {
+      static constexpr auto name = NAME;
+   };
+
+   constexpr literal_t path = "Assets/Shaders/Default.glsl";
+   constexpr auto extension = path.substr(path.rfind('.') + 1);
+
+   static_assert(Component<"pos">::name == "pos");
+   static_assert(Component<"pos">::name != Component<"vel">::name);
+   static_assert(Component<"pos">::name < Component<"vel">::name);
+   static_assert(extension == "glsl");
+   static_assert(path.starts_with("Assets/"));
+   static_assert(literal_t {"Default"} + "." + extension == path.substr(path.rfind('/') + 1));
+}
+
+auto LangulusBenchHash() {
+   return path.hash() ^ extension.hash();
+}
@@ -0,0 +1,261 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+
+
+namespace Langulus
+{
+   ///                                                                        
+   /// A type-erased handle to a literal of any character type and capacity   
+   ///                                                                        
+   /// Just a pointer, a length, the character kind and the precomputed       
+   /// hash, so it's trivially copyable, and runtime code can take literals   
+   /// without being a template on <T, N>. Like a string view, it doesn't     
+   /// own the characters. Length and hash are computed on construction,      
+   /// so one made in a constant expression costs nothing at runtime, e.g.    
+   ///   constexpr any_literal name = Component<"pos">::name;                 
+   /// Contents of different character kinds are never equal, and order by    
+   /// kind first                                                             
+   ///                                                                        
+   struct any_literal {
+      enum class Kind : uint8_t {
+         Char, WideChar, Char8, Char16, Char32
+      };
+
+      template<CT::LiteralChar T>
+      static constexpr Kind KindOf = ::std::same_as<T, char> ? Kind::Char
+         : ::std::same_as<T, wchar_t> ? Kind::WideChar
+         : ::std::same_as<T, char8_t> ? Kind::Char8
+         : ::std::same_as<T, char16_t> ? Kind::Char16
+         : Kind::Char32;
+
+      static constexpr size_t npos = ::std::string_view::npos;
+
+   private:
+      /// Only the member of the current kind is active, which keeps the      
+      /// handle usable in constant expressions, unlike a void pointer        
+      union Pointer {
+         const char*     c;
+         const wchar_t*  w;
+         const char8_t*  c8;
+         const char16_t* c16;
+         const char32_t* c32;
+      };
+
+      Pointer  _data {.c = ""};
+      size_t   _size = 0;
+      uint64_t _hash = HashLiteral(::std::string_view {});
+      Kind     _kind = Kind::Char;
+
+      template<CT::LiteralChar T>
+      static constexpr Pointer PointerTo(const T* data) noexcept {
+         if constexpr (::std::same_as<T, char>)          return {.c = data};
+         else if constexpr (::std::same_as<T, wchar_t>)  return {.w = data};
+         else if constexpr (::std::same_as<T, char8_t>)  return {.c8 = data};
+         else if constexpr (::std::same_as<T, char16_t>) return {.c16 = data};
+         else                                            return {.c32 = data};
+      }
+
+      /// Call f with the contents as a basic_string_view of the right kind   
+      template<class F>
+      constexpr decltype(auto) Visit(F&& f) const {
+         switch (_kind) {
+         case Kind::Char:     return f(::std::basic_string_view {_data.c, _size});
+         case Kind::WideChar: return f(::std::basic_string_view {_data.w, _size});
+         case Kind::Char8:    return f(::std::basic_string_view {_data.c8, _size});
+         case Kind::Char16:   return f(::std::basic_string_view {_data.c16, _size});
+         default:             return f(::std::basic_string_view {_data.c32, _size});
+         }
+      }
+
+      /// Call f with both contents, or return 'mismatch' if kinds differ     
+      template<class R, class F>
+      constexpr R Visit(const any_literal& other, R mismatch, F&& f) const {
+         if (_kind != other._kind)
+            return mismatch;
+
+         return Visit([&]<class T>(::std::basic_string_view<T> lhs) -> R {
+            return f(lhs, other.view<T>());
+         });
+      }
+
+      /// Call f with the contents and a character, or return 'mismatch' if   
+      /// the character's code unit can't be represented in the current kind  
+      template<CT::LiteralChar C, class R, class F>
+      constexpr R Visit(C c, R mismatch, F&& f) const {
+         using code_t = ::std::make_unsigned_t<C>;
+         return Visit([&]<class T>(::std::basic_string_view<T> lhs) -> R {
+            const auto converted = static_cast<T>(static_cast<code_t>(c));
+            if (static_cast<::std::make_unsigned_t<T>>(converted) != static_cast<code_t>(c))
+               return mismatch;
+            return f(lhs, converted);
+         });
+      }
+
+   public:
+      constexpr any_literal() noexcept = default;
+
+      template<CT::LiteralChar T>
+      constexpr any_literal(::std::basic_string_view<T> view) noexcept
+         : _data {PointerTo(view.data())}
+         , _size {view.size()}
+         , _hash {HashLiteral(view)}
+         , _kind {KindOf<T>} {}
+
+      template<CT::LiteralChar T>
+      constexpr any_literal(::std::basic_string_view<T> view, uint64_t precomputed) noexcept
+         : _data {PointerTo(view.data())}
+         , _size {view.size()}
+         , _hash {precomputed}
+         , _kind {KindOf<T>} {}
+
+      template<CT::LiteralChar T, size_t N>
+      constexpr any_literal(const T(&array)[N]) noexcept
+         : any_literal {::std::basic_string_view<T> {array}} {}
+
+      /// Refers to the literal's characters, so it must outlive the handle   
+      template<class T, size_t N> requires CT::LiteralString<literal_t<T, N>>
+      constexpr any_literal(const literal_t<T, N>& literal) noexcept
+         : any_literal {static_cast<::std::basic_string_view<T>>(literal), literal.hash()} {}
+
+      template<class T, size_t N> requires CT::LiteralString<literal_t<T, N>>
+      any_literal(const literal_t<T, N>&&) = delete;
+
+      ///                                                                     
+      /// Encapsulation                                                       
+      ///                                                                     
+      constexpr Kind kind() const noexcept { return _kind; }
+      constexpr size_t size() const noexcept { return _size; }
+      constexpr size_t length() const noexcept { return _size; }
+      constexpr bool empty() const noexcept { return _size == 0; }
+      constexpr uint64_t hash() const noexcept { return _hash; }
+
+      template<CT::LiteralChar T>
+      constexpr bool is() const noexcept {
+         return _kind == KindOf<T>;
+      }
+
+      /// The contents as a view of the given kind                            
+      ///   @attention the kind must match, see is<T>()                       
+      template<CT::LiteralChar T>
+      constexpr ::std::basic_string_view<T> view() const lgls_has_assumptions {
+         lgls_assume(is<T>(), "Viewing any_literal as the wrong character kind");
+         if constexpr (::std::same_as<T, char>)          return {_data.c, _size};
+         else if constexpr (::std::same_as<T, wchar_t>)  return {_data.w, _size};
+         else if constexpr (::std::same_as<T, char8_t>)  return {_data.c8, _size};
+         else if constexpr (::std::same_as<T, char16_t>) return {_data.c16, _size};
+         else                                            return {_data.c32, _size};
+      }
+
+      /// Get a region of the string, hashed anew                             
+      constexpr any_literal substr(size_t pos = 0, size_t count = npos) const {
+         return Visit([&](auto v) { return any_literal {v.substr(pos, count)}; });
+      }
+
+      ///                                                                     
+      /// Search - a needle of a different kind is never found                
+      ///                                                                     
+      constexpr size_t find(const any_literal& s, size_t pos = 0) const noexcept {
+         return Visit(s, npos, [pos](auto h, auto n) { return h.find(n, pos); });
+      }
+      constexpr size_t find(CT::LiteralChar auto c, size_t pos = 0) const noexcept {
+         return Visit(c, npos, [pos](auto h, auto n) { return h.find(n, pos); });
+      }
+
+      constexpr size_t rfind(const any_literal& s, size_t pos = npos) const noexcept {
+         return Visit(s, npos, [pos](auto h, auto n) { return h.rfind(n, pos); });
+      }
+      constexpr size_t rfind(CT::LiteralChar auto c, size_t pos = npos) const noexcept {
+         return Visit(c, npos, [pos](auto h, auto n) { return h.rfind(n, pos); });
+      }
+
+      constexpr size_t find_first_of(const any_literal& s, size_t pos = 0) const noexcept {
+         return Visit(s, npos, [pos](auto h, auto n) { return h.find_first_of(n, pos); });
+      }
+      constexpr size_t find_first_of(CT::LiteralChar auto c, size_t pos = 0) const noexcept {
+         return Visit(c, npos, [pos](auto h, auto n) { return h.find_first_of(n, pos); });
+      }
+
+      constexpr size_t find_last_of(const any_literal& s, size_t pos = npos) const noexcept {
+         return Visit(s, npos, [pos](auto h, auto n) { return h.find_last_of(n, pos); });
+      }
+      constexpr size_t find_last_of(CT::LiteralChar auto c, size_t pos = npos) const noexcept {
+         return Visit(c, npos, [pos](auto h, auto n) { return h.find_last_of(n, pos); });
+      }
+
+      constexpr size_t find_first_not_of(const any_literal& s, size_t pos = 0) const noexcept {
+         return Visit(s, npos, [pos](auto h, auto n) { return h.find_first_not_of(n, pos); });
+      }
+      constexpr size_t find_first_not_of(CT::LiteralChar auto c, size_t pos = 0) const noexcept {
+         return Visit(c, npos, [pos](auto h, auto n) { return h.find_first_not_of(n, pos); });
+      }
+
+      constexpr size_t find_last_not_of(const any_literal& s, size_t pos = npos) const noexcept {
+         return Visit(s, npos, [pos](auto h, auto n) { return h.find_last_not_of(n, pos); });
+      }
+      constexpr size_t find_last_not_of(CT::LiteralChar auto c, size_t pos = npos) const noexcept {
+         return Visit(c, npos, [pos](auto h, auto n) { return h.find_last_not_of(n, pos); });
+      }
+
+      constexpr bool starts_with(const any_literal& s) const noexcept {
+         return Visit(s, false, [](auto h, auto n) { return h.starts_with(n); });
+      }
+      constexpr bool starts_with(CT::LiteralChar auto c) const noexcept {
+         return Visit(c, false, [](auto h, auto n) { return h.starts_with(n); });
+      }
+
+      constexpr bool ends_with(const any_literal& s) const noexcept {
+         return Visit(s, false, [](auto h, auto n) { return h.ends_with(n); });
+      }
+      constexpr bool ends_with(CT::LiteralChar auto c) const noexcept {
+         return Visit(c, false, [](auto h, auto n) { return h.ends_with(n); });
+      }
+
+      constexpr bool contains(const any_literal& s) const noexcept {
+         return find(s) != npos;
+      }
+      constexpr bool contains(CT::LiteralChar auto c) const noexcept {
+         return find(c) != npos;
+      }
+
+      ///                                                                     
+      /// Compare - by kind first, then by contents like std::basic_string    
+      ///                                                                     
+      constexpr int compare(const any_literal& other) const noexcept {
+         if (_kind != other._kind)
+            return _kind < other._kind ? -1 : 1;
+         return Visit(other, 0, [](auto l, auto r) { return l.compare(r); });
+      }
+
+      /// Different hashes mean different contents, so most mismatches are    
+      /// found without looking at the characters                             
+      constexpr bool operator == (const any_literal& other) const noexcept {
+         return _hash == other._hash and _size == other._size
+            and Visit(other, false, [](auto l, auto r) { return l == r; });
+      }
+
+      constexpr ::std::strong_ordering operator <=> (const any_literal& other) const noexcept {
+         return compare(other) <=> 0;
+      }
+   };
+
+   static_assert(::std::is_trivially_copyable_v<any_literal>);
+}
+
+namespace std
+{
+   /// Hash support, same as literal_t::hash() of the same contents           
+   template<>
+   struct hash<::Langulus::any_literal> {
+      lgls_inline
+      size_t operator()(const ::Langulus::any_literal& str) const noexcept {
+         return static_cast<size_t>(str.hash());
+      }
+   };
+}
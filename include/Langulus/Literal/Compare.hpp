@@ -0,0 +1,61 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Ordering of literal_t - operator <=>                                    
+///                                                                           
+#pragma once
+#include "Core.hpp"
+#include <compare>
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      /// Check if a string literal_t LHS can be ordered against RHS - a      
+      /// literal string of the same character type, or anything that is      
+      /// convertible to its view_type                                        
+      template<class LHS, class RHS>
+      consteval bool OrderableWith() {
+         if constexpr (not IsText<LHS>)
+            return false;
+         else if constexpr (IsLiteral<RHS>) {
+            return IsText<RHS> and ::std::is_same_v<
+               typename LHS::value_type, typename RHS::value_type>;
+         }
+         else return ::std::is_convertible_v<const RHS&, typename LHS::view_type>;
+      }
+   }
+
+   ///                                                                        
+   /// The only operator <=> of literal_t - like operator ==, the left side   
+   /// is always deduced as a literal_t, and the reversed candidates of       
+   /// C++20 cover views and arrays on the left                               
+   ///                                                                        
+   template<class T, size_t N, class RHS>
+   requires (Inner::OrderableWith<literal_t<T, N>, RHS>())
+   constexpr auto operator <=> (const literal_t<T, N>& lhs, const RHS& rhs) {
+      using sv_type = typename literal_t<T, N>::view_type;
+
+      if constexpr (Inner::IsLiteral<RHS>) {
+         if constexpr (sizeof(T) == 1
+         and Inner::Packable<T, N>
+         and Inner::Packable<T, RHS::ArraySize>) {
+            // Short byte strings - byte-swapped words compare just like   
+            // memcmp, and terminators are zero, so shorter sorts first    
+            const auto l = lhs.packed();
+            const auto r = rhs.packed();
+            const auto order = ::std::byteswap(l.words[0]) <=> ::std::byteswap(r.words[0]);
+            if (order != 0)
+               return order;
+            return ::std::byteswap(l.High()) <=> ::std::byteswap(r.High());
+         }
+         else return static_cast<sv_type>(lhs) <=> static_cast<sv_type>(rhs);
+      }
+      else return static_cast<sv_type>(lhs) <=> static_cast<sv_type>(rhs);
+   }
+}
@@ -0,0 +1,53 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Concatenation of literal_t - operator +                                 
+///                                                                           
+#pragma once
+#include "Core.hpp"
+
+
+namespace Langulus
+{
+   ///                                                                        
+   /// Concatenation                                                          
+   ///                                                                        
+   template<CT::LiteralString LHS, CT::LiteralString RHS>
+   constexpr auto operator + (const LHS& lhs, const RHS& rhs) {
+      typename LHS::template Resized<LHS::ArraySize + RHS::ArraySize> result {lhs};
+      result += rhs;
+      return result;
+   }
+
+   template<CT::LiteralChar C, size_t N, CT::LiteralString RHS>
+   constexpr auto operator + (const C(&lhs)[N], const RHS& rhs) {
+      typename RHS::template Resized<N + RHS::ArraySize> result {lhs};
+      result += rhs;
+      return result;
+   }
+
+   template<CT::LiteralChar C, size_t N, CT::LiteralString LHS>
+   constexpr auto operator + (const LHS& lhs, const C(&rhs)[N]) {
+      typename LHS::template Resized<LHS::ArraySize + N> result {lhs};
+      result += rhs;
+      return result;
+   }
+
+   template<CT::LiteralChar C, CT::LiteralString RHS>
+   constexpr auto operator + (C lhs, const RHS& rhs) {
+      typename RHS::template Resized<1 + RHS::ArraySize> result {lhs};
+      result += rhs;
+      return result;
+   }
+
+   template<CT::LiteralChar C, CT::LiteralString LHS>
+   constexpr auto operator + (const LHS& lhs, C rhs) {
+      typename LHS::template Resized<1 + LHS::ArraySize> result {lhs};
+      result += rhs;
+      return result;
+   }
+}
@@ -0,0 +1,1299 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// The lean part of literal_t - the type itself with all of its members,    
+/// CTAD, the concepts and operator ==, i.e. everything needed to use it as   
+/// a template argument. The free functions are opt-in - operator <=> in      
+/// Compare.hpp, operator + in Concat.hpp, HashLiteral and the std::hash and  
+/// std::swap support in Hash.hpp, or all at once in <Langulus/Literal.hpp>   
+///                                                                           
+#pragma once
+#include <array>
+#include <string_view>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+/// You decide whether literal types throw or not                             
+#ifdef LANGULUS_OPTION_SAFE_MODE
+   #include <stdexcept>
+   #define lgls_has_assumptions
+   #define lgls_if_safe(a) a
+   #define lgls_if_unsafe(a)
+   #define lgls_assume(CONDITION, MESSAGE) \
+      if (not static_cast<bool>(CONDITION)) \
+         throw ::std::runtime_error {MESSAGE};
+
+   #if defined(_MSC_VER) and not defined(__clang__)
+      #define lgls_assume_and_optimize(CONDITION, MESSAGE) \
+         if (not static_cast<bool>(CONDITION)) \
+            throw ::std::runtime_error {MESSAGE};
+   #else
+      #define lgls_assume_and_optimize(CONDITION, MESSAGE) \
+         if (not static_cast<bool>(CONDITION)) \
+            throw ::std::runtime_error {MESSAGE}; \
+         [[assume(CONDITION)]]
+   #endif
+#else
+   #define lgls_has_assumptions noexcept
+   #define lgls_if_safe(a)
+   #define lgls_if_unsafe(a) a
+   #define lgls_assume(CONDITION, MESSAGE)
+   #define lgls_assume_and_optimize(CONDITION, MESSAGE)
+#endif
+
+#if defined(_MSC_VER) and not defined(__clang__)
+   #define lgls_inline __forceinline
+   #define lgls_noinline __declspec(noinline)
+   #define lgls_pure
+#else
+   #define lgls_inline __attribute__((always_inline)) inline
+   #define lgls_noinline __attribute__((noinline))
+   #define lgls_pure __attribute__((pure))
+#endif
+
+
+namespace Langulus
+{
+   /// Used as a return type in unsupported functions                         
+   struct Unsupported {};
+
+   namespace CT
+   {
+      /// Check if all T are complete (defined), by exploiting sizeof.        
+      /// Usefulness of this is limited to the first instantiation, and       
+      /// that is how it is used upon reflection. Thankfully, most modern     
+      /// compilers do detect if a definition changes between completeness    
+      /// checks, so it is unlikely to cause any real harm:                   
+      /// https://stackoverflow.com/questions/21119281                        
+      template<class...T>
+      concept Complete = (sizeof...(T) > 0) and ((sizeof(T) == sizeof(T)) and ...);
+
+      namespace Inner
+      {
+         template<class...T>
+         consteval bool ValidateInner() {
+            static_assert(sizeof...(T) > 0,
+               "No arguments provided");
+            static_assert(((Complete<T> or ::std::is_void_v<T>) and ...),
+               "Incomplete type in CT check");
+            return true;
+         }
+
+         template<class...T>
+         consteval bool PartialValidateInner() {
+            static_assert(sizeof...(T) > 0, "No arguments provided");
+            return true;
+         }
+      }
+
+      /// Makes sure an error is reported if a CT concept is tested without   
+      /// any arguments, or if any argument is an incomplete type, so that    
+      /// failures aren't silent.                                             
+      ///   @attention 'void' is not considered incomplete in this context    
+      template<class...T>
+      concept Validate = Inner::ValidateInner<T...>();
+
+      /// Check if all T are literal_t types                                  
+      template<class...T>
+      concept Literal = Validate<T...> and (T::CTTI_Literal and ...);
+      
+      /// Supported character types used by LiteralString                     
+      template<class...T>
+      concept LiteralChar = Validate<T...> and ((
+              ::std::same_as<::std::remove_cv_t<T>, char>
+           or ::std::same_as<::std::remove_cv_t<T>, wchar_t>
+           or ::std::same_as<::std::remove_cv_t<T>, char8_t>
+           or ::std::same_as<::std::remove_cv_t<T>, char16_t>
+           or ::std::same_as<::std::remove_cv_t<T>, char32_t>
+         ) and ...);
+      
+      /// Check if all T are literal_t strings                                
+      template<class...T>
+      concept LiteralString = Literal<T...>
+          and ((T::ArraySize > 0 and LiteralChar<typename T::value_type>) and ...);
+      
+      /// Check if all T are literal_t values                                 
+      template<class...T>
+      concept LiteralValue = Literal<T...> and ((T::ArraySize == 0
+          and not ::std::same_as<::std::remove_cv_t<typename T::value_type>, Unsupported>) and ...);
+      
+      /// Check if all T are literal_t values, but undefined                  
+      template<class...T>
+      concept LiteralUndefined = Literal<T...>
+          and (::std::same_as<::std::remove_cv_t<typename T::value_type>, Unsupported> and ...);
+   }
+
+   using Token = ::std::string_view;
+
+   namespace Inner
+   {
+      /// Widest integer a short literal can be packed into                   
+      #ifdef __SIZEOF_INT128__
+         using uint128_t = unsigned __int128;
+         constexpr size_t IntegerBytes = 16;
+      #else
+         constexpr size_t IntegerBytes = 8;
+      #endif
+
+      ///                                                                     
+      /// Short strings, packed into one or two 64-bit words                  
+      ///                                                                     
+      /// Character i always lands at bit 'i * bits-per-character' of the     
+      /// little-endian word sequence, regardless of platform, and anything   
+      /// after the first terminator is masked out, so packed values depend   
+      /// only on the contents and not on the capacity they came from         
+      ///                                                                     
+      template<class T, size_t N>
+      struct Packed {
+         static constexpr size_t Bytes = N * sizeof(T);
+         static constexpr size_t Words = Bytes <= 8 ? 1 : 2;
+         static constexpr size_t Lanes = 8 / sizeof(T);
+         static constexpr size_t LaneBits = sizeof(T) * 8;
+
+         uint64_t words[Words] {};
+         size_t   size = 0;
+
+         /// The second word, or zero if there's only one                     
+         constexpr uint64_t High() const noexcept {
+            if constexpr (Words > 1)
+               return words[1];
+            else
+               return 0;
+         }
+
+         /// Pack at most N characters, stopping at the first terminator      
+         static constexpr Packed Load(const T* data) noexcept {
+            Packed result;
+            if consteval {
+               result.LoadSlow(data);
+            }
+            else {
+               if constexpr (::std::endian::native == ::std::endian::little) {
+                  // Fixed-size copy, compiles to one or two plain loads      
+                  ::std::memcpy(result.words, data, Bytes);
+                  result.Terminate();
+               }
+               else result.LoadSlow(data);
+            }
+            return result;
+         }
+
+      private:
+         using lane_t = ::std::make_unsigned_t<T>;
+         static constexpr uint64_t LaneLsbs = ~uint64_t {0} / static_cast<lane_t>(-1);
+         static constexpr uint64_t LaneMsbs = LaneLsbs << (LaneBits - 1);
+
+         constexpr void LoadSlow(const T* data) noexcept {
+            for (; size < N and data[size]; ++size) {
+               words[size / Lanes] |= static_cast<uint64_t>(static_cast<lane_t>(data[size]))
+                  << (size % Lanes * LaneBits);
+            }
+         }
+
+         /// Find the first zero lane, and clear everything from it on.       
+         /// Borrows in the subtraction can only set flags above the first    
+         /// zero lane, so the lowest flag is always exact                    
+         constexpr void Terminate() noexcept {
+            for (size_t w = 0; w < Words; ++w) {
+               const auto zeroes = (words[w] - LaneLsbs) & ~words[w] & LaneMsbs;
+               if (not zeroes) {
+                  size += Lanes;
+                  continue;
+               }
+
+               const auto lane = static_cast<size_t>(::std::countr_zero(zeroes)) / LaneBits;
+               words[w] &= lane ? ~uint64_t {0} >> (64 - lane * LaneBits) : 0;
+               size += lane;
+               for (++w; w < Words; ++w)
+                  words[w] = 0;
+               return;
+            }
+
+            // No terminator, all N characters are used                       
+            size = N;
+         }
+      };
+
+      /// Same as CT::LiteralChar, but for a single type, and without the     
+      /// validation - it's checked for every literal_t, and every operand    
+      /// of every comparison with one                                        
+      template<class T>
+      constexpr bool IsChar = ::std::is_same_v<T, char>
+         or ::std::is_same_v<T, wchar_t>
+         or ::std::is_same_v<T, char8_t>
+         or ::std::is_same_v<T, char16_t>
+         or ::std::is_same_v<T, char32_t>;
+
+      /// Can a literal_t<T, N> be processed in packed form                   
+      template<class T, size_t N>
+      concept Packable = N > 0 and N * sizeof(T) <= 16 and IsChar<::std::remove_cv_t<T>>;
+
+      ///                                                                     
+      /// The runtime work behind literal_t members that isn't done in        
+      /// packed form. Depends only on the character type, so every capacity  
+      /// of it shares a single copy of each function, and literal_t<T, N>    
+      /// members are only thin shims that pass their N along as an argument. 
+      /// Functions are defined next to the members that use them, and are    
+      /// never inlined, or there would again be a copy in every shim         
+      ///                                                                     
+      template<class T>
+      struct Text {
+         /// Characters before the terminator, or capacity if there's none    
+         lgls_noinline static size_t Length(const T*, size_t capacity) noexcept;
+
+         /// Compare the contents of two strings of known lengths             
+         lgls_noinline static bool Equal(const T*, size_t, const T*, size_t) noexcept;
+
+         /// Copy a region of a string of known size to 'out', terminated     
+         lgls_noinline static void Substr(T* out, const T*, size_t size, size_t pos, size_t count) noexcept;
+
+         /// Copy 'count' characters at the end of a string of known size,    
+         /// but never more than fit in its capacity                          
+         lgls_noinline static void Append(T*, size_t size, size_t capacity, const T*, size_t count) noexcept;
+      };
+
+      template<class T>
+      size_t Text<T>::Length(const T* data, size_t capacity) noexcept {
+         if constexpr (IsChar<T>) {
+            const auto found = ::std::char_traits<T>::find(data, capacity, T {});
+            return found ? static_cast<size_t>(found - data) : capacity;
+         }
+         else {
+            size_t size = 0;
+            while (size != capacity and data[size] != T {})
+               ++size;
+            return size;
+         }
+      }
+
+      template<class T>
+      bool Text<T>::Equal(const T* lhs, size_t lhsSize, const T* rhs, size_t rhsSize) noexcept {
+         if (lhsSize != rhsSize)
+            return false;
+
+         if constexpr (IsChar<T>)
+            return ::std::char_traits<T>::compare(lhs, rhs, lhsSize) == 0;
+         else {
+            for (size_t i = 0; i < lhsSize; ++i) {
+               if (not (lhs[i] == rhs[i]))
+                  return false;
+            }
+            return true;
+         }
+      }
+
+      ///                                                                     
+      /// Constant evaluation of long literals                                
+      ///                                                                     
+      /// Compilers limit constant evaluation - clang counts every statement, 
+      /// GCC counts loop iterations - and one character per iteration runs   
+      /// out at a few hundred KiB. These take a whole block of characters    
+      /// per expression, and with clang use builtins that it evaluates in a  
+      /// single step, so the operations themselves stay within the default   
+      /// limits. Clang still caps the arrays at -fconstexpr-steps elements,  
+      /// which stops literals at 512 KiB - 1 characters                      
+      ///                                                                     
+      constexpr size_t ConstexprBlock = 16;
+
+      template<class T, size_t...I>
+      constexpr bool NoneZero(const T* data, ::std::index_sequence<I...>) noexcept {
+         return ((data[I] != T {}) and ...);
+      }
+
+      template<class T, class U, size_t...I>
+      constexpr void CopyBlock(T* to, const U* from, ::std::index_sequence<I...>) noexcept {
+         ((to[I] = static_cast<T>(from[I])), ...);
+      }
+
+      template<class T, size_t...I>
+      constexpr bool EqualBlock(const T* lhs, const T* rhs, ::std::index_sequence<I...>) noexcept {
+         return ((lhs[I] == rhs[I]) and ...);
+      }
+
+      /// Characters before the terminator, or capacity if there's none       
+      template<class T>
+      constexpr size_t ConstexprLength(const T* data, size_t capacity) noexcept {
+         #ifdef __clang__
+            // Only when the terminator is guaranteed, reading past the 
+            // storage would be an error rather than a result           
+            if (data[capacity] == T {}) {
+               if constexpr (::std::same_as<T, char>)
+                  return __builtin_strlen(data);
+               else if constexpr (::std::same_as<T, wchar_t>)
+                  return __builtin_wcslen(data);
+            }
+         #endif
+
+         constexpr auto block = ::std::make_index_sequence<ConstexprBlock> {};
+         size_t size = 0;
+         while (size + ConstexprBlock <= capacity and NoneZero(data + size, block))
+            size += ConstexprBlock;
+         while (size != capacity and data[size] != T {})
+            ++size;
+         return size;
+      }
+
+      /// Copy characters, converting them if types differ                    
+      template<class T, class U>
+      constexpr void ConstexprCopy(T* to, const U* from, size_t count) noexcept {
+         #ifdef __clang__
+            if constexpr (::std::same_as<T, U> and ::std::is_trivially_copyable_v<T>) {
+               __builtin_memcpy(to, from, count * sizeof(T));
+               return;
+            }
+         #endif
+
+         constexpr auto block = ::std::make_index_sequence<ConstexprBlock> {};
+         size_t i = 0;
+         for (; i + ConstexprBlock <= count; i += ConstexprBlock)
+            CopyBlock(to + i, from + i, block);
+         for (; i < count; ++i)
+            to[i] = static_cast<T>(from[i]);
+      }
+
+      /// Compare the first 'count' characters of two strings                 
+      template<class T>
+      constexpr bool ConstexprEqual(const T* lhs, const T* rhs, size_t count) noexcept {
+         #ifdef __clang__
+            if constexpr (sizeof(T) == 1 and IsChar<T>)
+               return __builtin_memcmp(lhs, rhs, count) == 0;
+            else if constexpr (::std::same_as<T, wchar_t>)
+               return __builtin_wmemcmp(lhs, rhs, count) == 0;
+         #endif
+
+         constexpr auto block = ::std::make_index_sequence<ConstexprBlock> {};
+         size_t i = 0;
+         for (; i + ConstexprBlock <= count; i += ConstexprBlock) {
+            if (not EqualBlock(lhs + i, rhs + i, block))
+               return false;
+         }
+         for (; i < count; ++i) {
+            if (not (lhs[i] == rhs[i]))
+               return false;
+         }
+         return true;
+      }
+   }
+
+   ///                                                                        
+   /// Acts as both a single value, or string literal. You can use it as a    
+   /// template parameter. The string implementation should be introduced in  
+   /// C++26 as std::fixed_string, supposedly...                              
+   ///                                                                        
+   /// String literals of different sizes result in unique types, and thus    
+   /// can't be used in `?:` statements, so I've taken the liberty to allow   
+   /// for strings of the form `? "\0\0\0" : "alt"` - left literal has        
+   /// `literal_t::ArraySize == 3`, but `size() == 0`. This also allows us to 
+   /// do some neat compile speed/memory optimizations by minimizing template 
+   /// instantiation via CTAD.                                                
+   ///                                                                        
+   template<class T, size_t N>
+   struct literal_t {
+      static_assert(N == 0 or ::std::has_single_bit(N),
+         "Modify N to minimize the number of templates");
+      static constexpr bool   CTTI_Literal = true;
+      static constexpr bool   Undefined = ::std::same_as<T, Unsupported>;
+      static constexpr size_t ArraySize = N;
+
+      using storage_type = ::std::array<T, N + 1>;
+      storage_type _data {};
+
+      using value_type = T;
+      using pointer = value_type*;
+      using const_pointer = const value_type*;
+      using reference = value_type&;
+      using const_reference = const value_type&;
+      using iterator = typename storage_type::iterator;
+      using const_iterator = typename storage_type::const_iterator;
+      using reverse_iterator = typename storage_type::reverse_iterator;
+      using const_reverse_iterator = typename storage_type::const_reverse_iterator;
+      using difference_type = ptrdiff_t;
+      using view_type = ::std::basic_string_view<value_type>;
+
+      static constexpr size_t npos = view_type::npos;
+
+      constexpr literal_t() noexcept = default;
+
+      constexpr literal_t(const value_type& c) noexcept {
+         _data[0] = c;
+      }
+
+      template<size_t M> requires (M <= N)
+      constexpr literal_t(const literal_t<char, M>& other) noexcept {
+         Inner::ConstexprCopy(_data.data(), other._data.data(), M);
+         _data[M] = 0;
+      }
+
+      template<size_t M> requires (M <= N + 1)
+      constexpr literal_t(const value_type(&array)[M]) noexcept {
+         Inner::ConstexprCopy(_data.data(), array, M);
+      }
+
+      constexpr literal_t& operator = (const value_type(&array)[N]) noexcept {
+         Inner::ConstexprCopy(_data.data(), array, N);
+         return *this;
+      }
+
+      ///                                                                     
+      /// Iteration                                                           
+      ///                                                                     
+      constexpr auto begin(this auto&& self) noexcept {
+         return self._data.begin();
+      }
+
+      constexpr auto end(this auto&& self) noexcept {
+         return self._data.begin() + self.size();
+      }
+
+      constexpr auto cbegin() const noexcept {
+         return _data.cbegin();
+      }
+
+      constexpr auto cend(this auto&& self) noexcept {
+         return self._data.cbegin() + self.size();
+      }
+
+      constexpr auto rbegin(this auto&& self) noexcept {
+         return self._data.rbegin() + (N - self.size());
+      }
+
+      constexpr auto rend(this auto&& self) noexcept {
+         return self._data.rend();
+      }
+
+      constexpr auto crbegin(this auto&& self) noexcept {
+         return self._data.crbegin() + (N - self.size());
+      }
+
+      constexpr auto crend() const noexcept {
+         return _data.crend();
+      }
+
+      ///                                                                     
+      /// Encapsulation                                                       
+      ///                                                                     
+      constexpr size_t size() const noexcept {
+         if constexpr (Inner::Packable<T, N>) {
+            if not consteval {
+               // Short literals find their terminator in registers           
+               return packed().size;
+            }
+         }
+
+         if constexpr (N > 0 and not Undefined) {
+            if not consteval {
+               return Inner::Text<T>::Length(_data.data(), N);
+            }
+            return Inner::ConstexprLength(_data.data(), N);
+         }
+         else return 0;
+      }
+      
+      constexpr bool empty() const noexcept {
+         if constexpr (N > 0 and not Undefined)
+            return not N or not _data[0];
+         else
+            return true;
+      }
+      
+      constexpr explicit operator bool () const noexcept {
+         if constexpr (Undefined) return false;
+         else return _data[0];
+      }
+
+      ///                                                                     
+      /// Access                                                              
+      /// @attention 'n' is always 0 when N == 0                              
+      constexpr decltype(auto) operator [] (this auto&& self, [[maybe_unused]] size_t n)
+      lgls_has_assumptions {
+         if constexpr (N > 0) {
+            #ifdef LANGULUS_OPTION_SAFE_MODE
+               //if not consteval {                                           
+                  if (n >= self.size())
+                     throw ::std::range_error("subscript index outside literal_t limits");
+               //}                                                            
+            #endif
+            return self._data[n];
+         }
+         else return self._data[0];
+      }
+
+      constexpr decltype(auto) at(this auto&& self, size_t n) {
+         return self._data.at(n);
+      }
+
+      constexpr decltype(auto) front(this auto&& self) noexcept {
+         return self._data.front();
+      }
+
+      constexpr decltype(auto) back(this auto&& self) noexcept {
+         return self._data[self.size() - 1];
+      }
+
+      constexpr auto data(this auto&& self) noexcept {
+         return self._data.data();
+      }
+
+      constexpr auto c_str() const noexcept {
+         return _data.data();
+      }
+
+      ///                                                                     
+      /// Retype                                                              
+      ///                                                                     
+      /// Get a resized Literal with the same properties                      
+      template<size_t M>
+      using Resized = literal_t<value_type, ::std::bit_ceil(M)>;
+
+   protected:
+      template<class, size_t>
+      friend struct literal_t;
+
+      template<size_t pos, size_t count, size_t size>
+      consteval static size_t clamp() {
+         if constexpr (pos >= size)
+            return 0;
+         return count < size - pos ? count : size - pos;
+      }
+
+      constexpr view_type sv() const { return *this; }
+
+   public:
+      /// Implicit cast to a first value, if N == 0                           
+      constexpr operator T() const noexcept requires (N == 0) {
+         return _data[0];
+      }
+      
+      /// Implicit cast to a string view, if N > 0                            
+      constexpr operator view_type() const noexcept requires (N > 0) {
+         return {data(), size()};
+      }
+
+      /// Contents packed in one or two 64-bit words, see Inner::Packed       
+      constexpr auto packed() const noexcept requires Inner::Packable<T, N> {
+         return Inner::Packed<T, N>::Load(_data.data());
+      }
+
+      ///                                                                     
+      /// Search                                                              
+      ///                                                                     
+      constexpr literal_t substr(size_t pos = 0, size_t count = npos) const noexcept;
+
+      template<size_t M>
+      constexpr size_t find(const Resized<M>&, size_t pos = 0) const noexcept;
+      constexpr size_t find(const view_type&, size_t pos = 0) const noexcept;
+      constexpr size_t find(const value_type*, size_t pos, size_t n) const;
+      constexpr size_t find(const value_type*, size_t pos = 0) const;
+      constexpr size_t find(value_type, size_t pos = 0) const noexcept;
+
+      template<size_t M>
+      constexpr size_t rfind(const Resized<M>&, size_t pos = npos) const noexcept;
+      constexpr size_t rfind(const view_type&, size_t pos = npos) const noexcept;
+      constexpr size_t rfind(const value_type*, size_t pos, size_t n) const;
+      constexpr size_t rfind(const value_type*, size_t pos = npos) const;
+      constexpr size_t rfind(value_type, size_t pos = npos) const noexcept;
+
+      template<size_t M>
+      constexpr size_t find_first_of(const Resized<M>&, size_t pos = 0) const noexcept;
+      constexpr size_t find_first_of(const view_type&, size_t pos = 0) const noexcept;
+      constexpr size_t find_first_of(const value_type*, size_t pos, size_t n) const;
+      constexpr size_t find_first_of(const value_type*, size_t pos = 0) const;
+      constexpr size_t find_first_of(value_type, size_t pos = 0) const noexcept;
+
+      template<size_t M>
+      constexpr size_t find_last_of(const Resized<M>&, size_t pos = npos) const noexcept;
+      constexpr size_t find_last_of(const view_type&, size_t pos = npos) const noexcept;
+      constexpr size_t find_last_of(const value_type*, size_t pos, size_t n) const;
+      constexpr size_t find_last_of(const value_type*, size_t pos = npos) const;
+      constexpr size_t find_last_of(value_type, size_t pos = npos) const noexcept;
+
+      template<size_t M>
+      constexpr size_t find_first_not_of(const Resized<M>&, size_t pos = 0) const noexcept;
+      constexpr size_t find_first_not_of(const view_type&, size_t pos = 0) const noexcept;
+      constexpr size_t find_first_not_of(const value_type*, size_t pos, size_t n) const;
+      constexpr size_t find_first_not_of(const value_type*, size_t pos = 0) const;
+      constexpr size_t find_first_not_of(value_type, size_t pos = 0) const noexcept;
+
+      template<size_t M>
+      constexpr size_t find_last_not_of(const Resized<M>&, size_t pos = npos) const noexcept;
+      constexpr size_t find_last_not_of(const view_type&, size_t pos = npos) const noexcept;
+      constexpr size_t find_last_not_of(const value_type*, size_t pos, size_t n) const;
+      constexpr size_t find_last_not_of(const value_type*, size_t pos = npos) const;
+      constexpr size_t find_last_not_of(value_type, size_t pos = npos) const noexcept;
+
+      constexpr bool starts_with(view_type) const noexcept;
+      constexpr bool starts_with(char) const noexcept;
+      constexpr bool starts_with(const value_type*) const noexcept;
+
+      constexpr bool ends_with(view_type) const noexcept;
+      constexpr bool ends_with(value_type) const noexcept;
+      constexpr bool ends_with(const value_type*) const;
+
+      constexpr bool contains(view_type) const noexcept;
+      constexpr bool contains(value_type) const noexcept;
+      constexpr bool contains(const value_type*) const;
+
+
+      ///                                                                     
+      /// Compare                                                             
+      ///                                                                     
+      constexpr int compare(view_type) const noexcept;
+      constexpr int compare(size_t pos1, size_t count1, view_type) const;
+      constexpr int compare(size_t pos1, size_t count1, view_type, size_t pos2, size_t count2) const;
+      constexpr int compare(const value_type*) const;
+      constexpr int compare(size_t pos1, size_t count1, const value_type*) const;
+      constexpr int compare(size_t pos1, size_t count1, const value_type*, size_t count2) const;
+
+      ///                                                                     
+      /// Hash the contents                                                   
+      ///                                                                     
+      constexpr uint64_t hash() const noexcept requires (N > 0);
+
+      ///                                                                     
+      /// Short literal as a single integer, usable as a switch case label,   
+      /// for example `case literal_t {"GET"}.as_integer():`. Character i     
+      /// is at bit 'i * bits-per-character', on any platform                 
+      ///                                                                     
+      constexpr auto as_integer() const noexcept
+      requires Inner::Packable<T, N> and (N * sizeof(T) <= Inner::IntegerBytes) {
+         const auto p = packed();
+         if constexpr (Inner::Packed<T, N>::Words == 1)
+            return p.words[0];
+         else
+            return static_cast<Inner::uint128_t>(p.words[1]) << 64 | p.words[0];
+      }
+
+      void swap(literal_t& other) noexcept(std::is_nothrow_swappable_v<storage_type>) {
+         _data.swap(other._data);
+      }
+
+      ///                                                                     
+      /// Append a string literal                                             
+      ///   @attention will never allocate a bigger literal                   
+      ///                                                                     
+      constexpr literal_t& operator += (const CT::LiteralString auto&) noexcept;
+
+      template<CT::LiteralChar C, size_t M>
+      constexpr literal_t& operator += (const C(&)[M]) noexcept;
+   };
+
+   /// CTAD                                                                   
+   literal_t() ->literal_t<Unsupported, 0>;
+
+   template<class T>
+   literal_t(const T&) -> literal_t<T, 0>;
+   
+   /// CTAD witch a cheeky build optimization                                 
+   template<class T, size_t N>
+   literal_t(const T(&)[N]) -> literal_t<T, ::std::bit_ceil(N)>;
+
+
+   namespace Inner
+   {
+      ///                                                                     
+      /// Plain checks for the comparison operators, instead of the CT        
+      /// concepts - they are tested for the operands of every comparison     
+      /// that involves a literal_t, and these don't instantiate Validate     
+      ///                                                                     
+
+      /// Check if T is literal_t, or derived from it, like inplace_literal   
+      template<class T>
+      constexpr bool IsLiteral = requires { T::CTTI_Literal; };
+
+      /// Check if a literal_t (or derived) type is a string                  
+      template<class T>
+      constexpr bool IsText = T::ArraySize > 0
+         and IsChar<::std::remove_cv_t<typename T::value_type>>;
+
+      /// What a literal_t is compared against, see EqualityOf                
+      enum class Equality {
+         None,          // Not comparable
+         Literals,      // Another literal_t of any kind
+         Views,         // Anything convertible to the literal's view_type
+         Empty,         // Undefined against anything convertible to a view
+         Terminator,    // Undefined against a character array
+         First          // Value against an array of the value type
+      };
+
+      /// Pick the comparison of a literal_t LHS against RHS, once per pair   
+      template<class LHS, class RHS>
+      consteval Equality EqualityOf() {
+         if constexpr (IsLiteral<RHS>)
+            return Equality::Literals;
+         else if constexpr (LHS::Undefined) {
+            if constexpr (::std::is_array_v<RHS>
+            and IsChar<::std::remove_cv_t<::std::remove_extent_t<RHS>>>)
+               return Equality::Terminator;
+            else if constexpr (::std::is_convertible_v<const RHS&, ::std::string_view>)
+               return Equality::Empty;
+            else
+               return Equality::None;
+         }
+         else if constexpr (LHS::ArraySize == 0) {
+            if constexpr (::std::is_array_v<RHS> and ::std::is_same_v<
+               ::std::remove_cv_t<::std::remove_extent_t<RHS>>, typename LHS::value_type>)
+               return Equality::First;
+            else
+               return Equality::None;
+         }
+         else if constexpr (IsText<LHS>
+         and ::std::is_convertible_v<const RHS&, typename LHS::view_type>)
+            return Equality::Views;
+         else
+            return Equality::None;
+      }
+   }
+
+
+   ///                                                                        
+   /// The only operator == of literal_t - the left side is always deduced    
+   /// as a literal_t, so unrelated types are discarded before any check,     
+   /// and every other order of operands is covered by the reversed           
+   /// candidates of C++20. Compares against another literal of any kind,     
+   /// against views, strings and character arrays, and values against        
+   /// arrays of their type - see Inner::EqualityOf                           
+   ///                                                                        
+   template<class T, size_t N, class RHS>
+   requires (Inner::EqualityOf<literal_t<T, N>, RHS>() != Inner::Equality::None)
+   constexpr bool operator == (const literal_t<T, N>& lhs, const RHS& rhs) {
+      using LHS = literal_t<T, N>;
+      constexpr auto kind = Inner::EqualityOf<LHS, RHS>();
+
+      if constexpr (kind == Inner::Equality::Views) {
+         // String against a view, std::string, pointer or array        
+         using sv_type = typename LHS::view_type;
+         return static_cast<sv_type>(lhs) == static_cast<sv_type>(rhs);
+      }
+      else if constexpr (kind == Inner::Equality::Empty)
+         return static_cast<::std::string_view>(rhs).empty();
+      else if constexpr (kind == Inner::Equality::Terminator)
+         return rhs[0] == '\0';
+      else if constexpr (kind == Inner::Equality::First)
+         return lhs[0] == rhs[0];
+      else if constexpr (Inner::IsText<LHS> and Inner::IsText<RHS>
+      and ::std::is_same_v<typename LHS::value_type, typename RHS::value_type>
+      and Inner::Packable<typename LHS::value_type, LHS::ArraySize>
+      and Inner::Packable<typename RHS::value_type, RHS::ArraySize>) {
+         // Both are short strings of the same kind - compare words     
+         const auto l = lhs.packed();
+         const auto r = rhs.packed();
+         return l.words[0] == r.words[0] and l.High() == r.High();
+      }
+      else if constexpr (Inner::IsText<LHS> and Inner::IsText<RHS>) {
+         // Both are strings                                            
+         if constexpr (::std::is_same_v<typename LHS::value_type, typename RHS::value_type>) {
+            if not consteval {
+               return Inner::Text<T>::Equal(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+            }
+         }
+
+         const auto size = lhs.size();
+         if (size != rhs.size())
+            return false;
+
+         if constexpr (::std::is_same_v<typename LHS::value_type, typename RHS::value_type>)
+            return Inner::ConstexprEqual(lhs.data(), rhs.data(), size);
+         else {
+            for (size_t i = 0; i < size; ++i) {
+               if (lhs[i] != rhs[i])
+                  return false;
+            }
+            return true;
+         }
+      }
+      else if constexpr (Inner::IsText<LHS>) {
+         // LHS is string, RHS is value/undefined                       
+         if constexpr (RHS::Undefined)
+            return lhs.empty();
+         else if constexpr (::std::equality_comparable_with<typename LHS::value_type, typename RHS::value_type>)
+            return (lhs.empty() and rhs.empty()) or (lhs.size() == 1 and lhs[0] == rhs[0]);
+         else
+            return false;
+      }
+      else if constexpr (Inner::IsText<RHS>) {
+         // LHS is value/undefined, RHS is string                       
+         if constexpr (LHS::Undefined)
+            return rhs.empty();
+         else if constexpr (::std::equality_comparable_with<typename LHS::value_type, typename RHS::value_type>)
+            return (lhs.empty() and rhs.empty()) or (rhs.size() == 1 and lhs[0] == rhs[0]);
+         else
+            return false;
+      }
+      else if constexpr (::std::equality_comparable_with<typename LHS::value_type, typename RHS::value_type>) {
+         // Both are values/undefined and comparable                    
+         return lhs[0] == rhs[0];
+      }
+      else {
+         // Both are values/undefined and uncomparable, and can be the  
+         // same only if both are undefined                             
+         return LHS::Undefined and RHS::Undefined;
+      }
+   }
+
+   /// Copy a region of a string of known size to 'out', terminated           
+   template<class T>
+   void Inner::Text<T>::Substr(T* out, const T* data, size_t size, size_t pos, size_t count) noexcept {
+      if (pos >= size)
+         return;
+
+      if (count > size - pos)
+         count = size - pos;
+
+      if constexpr (IsChar<T>)
+         ::std::char_traits<T>::copy(out, data + pos, count);
+      else for (size_t i = 0; i < count; ++i)
+         out[i] = data[pos + i];
+      out[count] = T {};
+   }
+
+   /// Get a region of the string                                             
+   template<class T, size_t N>
+   constexpr literal_t<T, N> literal_t<T, N>::substr(size_t pos, size_t count) const noexcept {
+      literal_t result;
+      if not consteval {
+         Inner::Text<T>::Substr(result._data.data(), _data.data(), size(), pos, count);
+         return result;
+      }
+
+      const size_t s = size();
+      if (pos >= s)
+         return result;
+
+      if (count > s - pos)
+         count = s - pos;
+
+      Inner::ConstexprCopy(result._data.data(), _data.data() + pos, count);
+      result._data[count] = 0;
+      return result;
+   }
+
+   /// Find                                                                   
+   template<class T, size_t N>
+   template<size_t M>
+   constexpr size_t literal_t<T, N>::find(const Resized<M>& str, size_t pos) const noexcept {
+      if constexpr (M > N)
+         return npos;
+      return sv().find(str.sv(), pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find(const view_type& view, size_t pos) const noexcept {
+      return sv().find(view, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find(const value_type* s, size_t pos, size_t n) const {
+      return sv().find(s, pos, n);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find(const value_type* s, size_t pos) const {
+      return sv().find(s, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find(value_type c, size_t pos) const noexcept {
+      return sv().find(c, pos);
+   }
+
+   /// Find in reverse                                                        
+   template<class T, size_t N>
+   template<size_t M>
+   constexpr size_t literal_t<T, N>::rfind(const Resized<M>& str, size_t pos) const noexcept {
+      if constexpr (M > N)
+         return npos;
+      return sv().rfind(str.sv(), pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::rfind(const view_type& view, size_t pos) const noexcept {
+      return sv().rfind(view, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::rfind(const value_type* s, size_t pos, size_t n) const {
+      return sv().rfind(s, pos, n);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::rfind(const value_type* s, size_t pos) const {
+      return sv().rfind(s, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::rfind(value_type c, size_t pos) const noexcept {
+      return sv().rfind(c, pos);
+   }
+
+   /// Find the first of                                                      
+   template<class T, size_t N>
+   template<size_t M>
+   constexpr size_t literal_t<T, N>::find_first_of(const Resized<M>& str, size_t pos) const noexcept {
+      if constexpr (M > N)
+         return npos;
+      return sv().find_first_of(str.sv(), pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_of(const view_type& view, size_t pos) const noexcept {
+      return sv().find_first_of(view, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_of(const value_type* s, size_t pos, size_t n) const {
+      return sv().find_first_of(s, pos, n);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_of(const value_type* s, size_t pos) const {
+      return sv().find_first_of(s, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_of(value_type c, size_t pos) const noexcept {
+      return sv().find_first_of(c, pos);
+   }
+
+   /// Find the last of                                                       
+   template<class T, size_t N>
+   template<size_t M>
+   constexpr size_t literal_t<T, N>::find_last_of(const Resized<M>& str, size_t pos) const noexcept {
+      if constexpr (M > N)
+         return npos;
+      return sv().find_last_of(str.sv(), pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_of(const view_type& view, size_t pos) const noexcept {
+      return sv().find_last_of(view, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_of(const value_type* s, size_t pos, size_t n) const {
+      return sv().find_last_of(s, pos, n);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_of(const value_type* s, size_t pos) const {
+      return sv().find_last_of(s, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_of(value_type c, size_t pos) const noexcept {
+      return sv().find_last_of(c, pos);
+   }
+
+   /// Find the first NOT of                                                  
+   template<class T, size_t N>
+   template<size_t M>
+   constexpr size_t literal_t<T, N>::find_first_not_of(const Resized<M>& str, size_t pos) const noexcept {
+      if constexpr (M > N)
+         return npos;
+      return sv().find_first_not_of(str.sv(), pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_not_of(const view_type& view, size_t pos) const noexcept {
+      return sv().find_first_not_of(view, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_not_of(const value_type* s, size_t pos, size_t n) const {
+      return sv().find_first_not_of(s, pos, n);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_not_of(const value_type* s, size_t pos) const {
+      return sv().find_first_not_of(s, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_first_not_of(value_type c, size_t pos) const noexcept {
+      return sv().find_first_not_of(c, pos);
+   }
+
+   /// Find the last NOT of                                                   
+   template<class T, size_t N>
+   template<size_t M>
+   constexpr size_t literal_t<T, N>::find_last_not_of(const Resized<M>& str, size_t pos) const noexcept {
+      if constexpr (M > N)
+         return npos;
+      return sv().find_last_not_of(str.sv(), pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_not_of(const view_type& view, size_t pos) const noexcept {
+      return sv().find_last_not_of(view, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_not_of(const value_type* s, size_t pos, size_t n) const {
+      return sv().find_last_not_of(s, pos, n);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_not_of(const value_type* s, size_t pos) const {
+      return sv().find_last_not_of(s, pos);
+   }
+   template<class T, size_t N>
+   constexpr size_t literal_t<T, N>::find_last_not_of(value_type c, size_t pos) const noexcept {
+      return sv().find_last_not_of(c, pos);
+   }
+
+   /// Starts with                                                            
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::starts_with(view_type v) const noexcept {
+      if constexpr (Inner::Packable<T, N>) {
+         if not consteval {
+            // Compare only the prefix lanes of the packed words              
+            if (v.size() > N)
+               return false;
+            const auto lhs = packed();
+            if (v.size() > lhs.size)
+               return false;
+
+            using packed_t = Inner::Packed<T, N>;
+            uint64_t rhs[packed_t::Words] {};
+            if constexpr (::std::endian::native == ::std::endian::little)
+               ::std::memcpy(rhs, v.data(), v.size() * sizeof(T));
+            else {
+               // Lanes in the same order Packed::Load puts them          
+               using lane_t = ::std::make_unsigned_t<T>;
+               for (size_t i = 0; i < v.size(); ++i) {
+                  rhs[i / packed_t::Lanes] |= static_cast<uint64_t>(static_cast<lane_t>(v[i]))
+                     << (i % packed_t::Lanes * packed_t::LaneBits);
+               }
+            }
+            const size_t bits = v.size() * sizeof(T) * 8;
+            for (size_t w = 0; w < packed_t::Words; ++w) {
+               const size_t used = bits > w * 64 ? bits - w * 64 : 0;
+               const uint64_t mask = used >= 64 ? ~uint64_t {0}
+                  : (uint64_t {1} << used) - 1;
+               if ((lhs.words[w] ^ rhs[w]) & mask)
+                  return false;
+            }
+            return true;
+         }
+      }
+      return sv().substr(0, v.size()) == v;
+   }
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::starts_with(char c) const noexcept {
+      return not empty() and ::std::char_traits<T>::eq(front(), c);
+   }
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::starts_with(const value_type* s) const noexcept {
+      return starts_with(view_type(s));
+   }
+
+   /// Ends with                                                              
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::ends_with(view_type v) const noexcept {
+      return size() >= v.size() && sv().compare(size() - v.size(), npos, v) == 0;
+   }
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::ends_with(value_type c) const noexcept {
+      return !empty() && ::std::char_traits<T>::eq(back(), c);
+   }
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::ends_with(const value_type* s) const {
+      return ends_with(view_type(s));
+   }
+
+   /// Contains                                                               
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::contains(view_type v) const noexcept {
+      return find(v) != npos;
+   }
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::contains(value_type c) const noexcept {
+      return find(c) != npos;
+   }
+   template<class T, size_t N>
+   constexpr bool literal_t<T, N>::contains(const value_type* s) const {
+      return find(s) != npos;
+   }
+
+   /// Compare                                                                
+   template<class T, size_t N>
+   constexpr int literal_t<T, N>::compare(view_type v) const noexcept {
+      return sv().compare(v);
+   }
+   template<class T, size_t N>
+   constexpr int literal_t<T, N>::compare(size_t pos1, size_t count1, view_type v) const {
+      return sv().compare(pos1, count1, v);
+   }
+   template<class T, size_t N>
+   constexpr int literal_t<T, N>::compare(size_t pos1, size_t count1, view_type v, size_t pos2, size_t count2) const {
+      return sv().compare(pos1, count1, v, pos2, count2);
+   }
+   template<class T, size_t N>
+   constexpr int literal_t<T, N>::compare(const value_type* s) const {
+      return sv().compare(s);
+   }
+   template<class T, size_t N>
+   constexpr int literal_t<T, N>::compare(size_t pos1, size_t count1, const value_type* s) const {
+      return sv().compare(pos1, count1, s);
+   }
+   template<class T, size_t N>
+   constexpr int literal_t<T, N>::compare(size_t pos1, size_t count1, const value_type* s, size_t count2) const {
+      return sv().compare(pos1, count1, s, count2);
+   }
+
+   /// Copy 'count' characters at the end of a string of known size, but      
+   /// never more than fit in its capacity, and terminate it                  
+   template<class T>
+   void Inner::Text<T>::Append(T* data, size_t size, size_t capacity, const T* src, size_t count) noexcept {
+      if (count > capacity - size)
+         count = capacity - size;
+
+      if constexpr (IsChar<T>)
+         ::std::char_traits<T>::copy(data + size, src, count);
+      else for (size_t i = 0; i < count; ++i)
+         data[size + i] = src[i];
+      data[size + count] = T {};
+   }
+
+   /// Append a string literal                                                
+   ///   @attention will never allocate a bigger literal                      
+   template<class T, size_t N>
+   constexpr literal_t<T, N>& literal_t<T, N>::operator += (const CT::LiteralString auto& rhs) noexcept {
+      if constexpr (::std::is_same_v<typename ::std::remove_cvref_t<decltype(rhs)>::value_type, T>) {
+         if not consteval {
+            Inner::Text<T>::Append(data(), size(), ArraySize, rhs.data(), rhs.size());
+            return *this;
+         }
+      }
+
+      // Sizes are taken before writing anything, so appending to itself
+      // is fine                                                        
+      const auto s = size();
+      const auto r = rhs.size();
+      const auto count = r < ArraySize - s ? r : ArraySize - s;
+      Inner::ConstexprCopy(data() + s, rhs.data(), count);
+      _data[s + count] = 0;
+      return *this;
+   }
+
+   template<class T, size_t N>
+   template<CT::LiteralChar C, size_t M>
+   constexpr literal_t<T, N>& literal_t<T, N>::operator += (const C(&rhs)[M]) noexcept {
+      if constexpr (::std::is_same_v<C, T>) {
+         if not consteval {
+            Inner::Text<T>::Append(data(), size(), ArraySize, rhs, M);
+            return *this;
+         }
+      }
+
+      const auto s = size();
+      const auto count = M < ArraySize - s ? M : ArraySize - s;
+      Inner::ConstexprCopy(data() + s, rhs, count);
+      _data[s + count] = 0;
+      return *this;
+   }
+
+   namespace Inner
+   {
+      ///                                                                     
+      /// The literal hash                                                    
+      ///                                                                     
+      /// Consumes the contents as zero-padded 64-bit words, so a short       
+      /// packed literal hashes with a couple of multiplications, and gives   
+      /// the same result for any capacity, for inplace_literal, and for a    
+      /// plain view with the same contents                                   
+      ///                                                                     
+      constexpr uint64_t HashSeed = 0x9E3779B97F4A7C15ull;
+
+      lgls_inline constexpr uint64_t HashStep(uint64_t h, uint64_t word) noexcept {
+         // Same as std::rotl by 31, but a single step of constant        
+         // evaluation, and still a single instruction at runtime          
+         const auto m = (h ^ word) * 0x87C37B91114253D5ull;
+         return (m << 31) | (m >> 33);
+      }
+
+      lgls_inline constexpr uint64_t HashFinal(uint64_t h) noexcept {
+         h ^= h >> 33;
+         h *= 0xFF51AFD7ED558CCDull;
+         h ^= h >> 33;
+         h *= 0xC4CEB9FE1A85EC53ull;
+         h ^= h >> 33;
+         return h;
+      }
+
+      /// Hash the packed form of a short string                              
+      template<class T, size_t N>
+      constexpr uint64_t HashPacked(const Packed<T, N>& packed) noexcept {
+         const size_t bytes = packed.size * sizeof(T);
+         auto h = HashStep(HashSeed ^ bytes, packed.words[0]);
+         if constexpr (Packed<T, N>::Words > 1) {
+            if (bytes > 8)
+               h = HashStep(h, packed.words[1]);
+         }
+         return HashFinal(h);
+      }
+
+      /// Gather a whole word of characters in a single expression, so that   
+      /// it's a single step of constant evaluation                           
+      template<class T, size_t...I>
+      constexpr uint64_t GatherWord(const T* data, ::std::index_sequence<I...>) noexcept {
+         using lane_t = ::std::make_unsigned_t<T>;
+         return ((static_cast<uint64_t>(static_cast<lane_t>(data[I])) << (I * sizeof(T) * 8)) | ...);
+      }
+
+      /// Hash whole words in a single expression, see GatherWord             
+      template<class T, size_t...W>
+      constexpr uint64_t HashWords(uint64_t h, const T* data, ::std::index_sequence<W...>) noexcept {
+         constexpr size_t Lanes = 8 / sizeof(T);
+         constexpr auto lanes = ::std::make_index_sequence<Lanes> {};
+         ((h = HashStep(h, GatherWord(data + W * Lanes, lanes))), ...);
+         return h;
+      }
+
+      /// Hash a string of any length, word by word                           
+      template<class T>
+      constexpr uint64_t HashView(::std::basic_string_view<T> view) noexcept {
+         constexpr size_t Lanes = 8 / sizeof(T);
+         using lane_t = ::std::make_unsigned_t<T>;
+         auto data = view.data();
+         auto count = view.size();
+         const size_t bytes = count * sizeof(T);
+         auto h = HashSeed ^ bytes;
+         if consteval {
+            // Eight words at a time, leaving at least one lane for the 
+            // loop below, which is what handles the last, partial word 
+            constexpr size_t Words = 8;
+            while (count > Words * Lanes) {
+               h = HashWords(h, data, ::std::make_index_sequence<Words> {});
+               data += Words * Lanes;
+               count -= Words * Lanes;
+            }
+         }
+
+         do {
+            const auto lanes = count < Lanes ? count : Lanes;
+            uint64_t word = 0;
+            const auto slow = [&] {
+               for (size_t i = 0; i < lanes; ++i)
+                  word |= static_cast<uint64_t>(static_cast<lane_t>(data[i])) << (i * sizeof(T) * 8);
+            };
+
+            if consteval {
+               if (lanes == Lanes)
+                  word = GatherWord(data, ::std::make_index_sequence<Lanes> {});
+               else
+                  slow();
+            }
+            else {
+               if constexpr (::std::endian::native == ::std::endian::little) {
+                  if (lanes == Lanes)
+                     ::std::memcpy(&word, data, 8);
+                  else if (lanes)
+                     ::std::memcpy(&word, data, lanes * sizeof(T));
+               }
+               else slow();
+            }
+
+            h = HashStep(h, word);
+            data += lanes;
+            count -= lanes;
+         }
+         while (count);
+         return HashFinal(h);
+      }
+   }
+
+   ///                                                                        
+   /// Hash the contents - see Inner::HashView. Doesn't depend on the         
+   /// capacity, and is the same at compile time and at runtime               
+   ///                                                                        
+   template<class T, size_t N>
+   constexpr uint64_t literal_t<T, N>::hash() const noexcept requires (N > 0) {
+      if constexpr (Inner::Packable<T, N>)
+         return Inner::HashPacked(packed());
+      else
+         return Inner::HashView(sv());
+   }
+}
@@ -0,0 +1,49 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Turning embedded bytes into literal_t, at compile time. The bytes usually 
+/// come from a header generated by langulus_embed_literal(), see             
+/// LangulusEmbed.cmake, e.g.                                                 
+///   #include "shader.hpp"                                                   
+///   static_assert(Langulus::Embedded::shader.starts_with("#version"));      
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+
+
+namespace Langulus
+{
+   ///                                                                        
+   /// Make a literal out of raw bytes, like the ones #embed produces         
+   ///                                                                        
+   /// The capacity is the same CTAD would give a string literal of that      
+   /// many characters. Since a terminator ends the contents, only text       
+   /// without zero bytes is embedded whole                                   
+   ///   @param bytes - the file contents, without a terminator               
+   ///   @return the literal                                                  
+   ///                                                                        
+   template<CT::LiteralChar T = char, size_t M> requires (sizeof(T) == 1)
+   consteval auto literal_from_bytes(const unsigned char(&bytes)[M]) noexcept {
+      literal_t<T, ::std::bit_ceil(M + 1)> result;
+      Inner::ConstexprCopy(result.data(), bytes, M);
+      return result;
+   }
+
+   ///                                                                        
+   /// Same as literal_from_bytes, but for bytes followed by a terminator,    
+   /// like the ones langulus_embed_literal() generates - an array can't be   
+   /// empty, but this way an empty file gets the capacity CTAD gives ""      
+   ///   @param bytes - the file contents, and a zero byte after them         
+   ///   @return the literal                                                  
+   ///                                                                        
+   template<CT::LiteralChar T = char, size_t M> requires (sizeof(T) == 1 and M > 0)
+   consteval auto literal_from_terminated_bytes(const unsigned char(&bytes)[M]) noexcept {
+      literal_t<T, ::std::bit_ceil(M)> result;
+      Inner::ConstexprCopy(result.data(), bytes, M - 1);
+      return result;
+   }
+}
@@ -0,0 +1,623 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Inplace.hpp"
+#include "HashBatch.hpp"
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__) or defined(_M_X64) or (defined(_M_IX86_FP) and _M_IX86_FP >= 2)
+   #include <emmintrin.h>
+   #define lgls_sse2 1
+#else
+   #define lgls_sse2 0
+#endif
+
+#if defined(__GNUC__) or defined(__clang__)
+   #define lgls_prefetch(a) __builtin_prefetch(a)
+#elif lgls_sse2
+   #include <xmmintrin.h>
+   #define lgls_prefetch(a) _mm_prefetch(reinterpret_cast<const char*>(a), _MM_HINT_T0)
+#else
+   #define lgls_prefetch(a)
+#endif
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      /// Control bytes, one per slot. Full slots hold the 7 low bits of      
+      /// the key's hash, the rest have the top bit set                       
+      using ctrl_t = int8_t;
+      constexpr ctrl_t CtrlEmpty    = -128;  // 0b10000000
+      constexpr ctrl_t CtrlDeleted  = -2;    // 0b11111110
+
+      #if lgls_sse2
+         ///                                                                  
+         /// A group of 16 control bytes, probed with SSE2                    
+         ///                                                                  
+         struct CtrlGroup {
+            static constexpr size_t Width = 16;
+            static constexpr int Shift = 0;
+            __m128i _ctrl;
+
+            lgls_inline explicit CtrlGroup(const ctrl_t* ctrl) noexcept
+               : _ctrl {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))} {}
+
+            /// Slots whose control byte matches the hash tag                 
+            lgls_inline uint64_t Match(ctrl_t tag) const noexcept {
+               return static_cast<uint32_t>(_mm_movemask_epi8(
+                  _mm_cmpeq_epi8(_mm_set1_epi8(tag), _ctrl)));
+            }
+
+            lgls_inline uint64_t MatchEmpty() const noexcept {
+               return Match(CtrlEmpty);
+            }
+
+            lgls_inline uint64_t MatchEmptyOrDeleted() const noexcept {
+               // Both have the top bit set, unlike any full slot       
+               return static_cast<uint32_t>(_mm_movemask_epi8(_ctrl));
+            }
+         };
+      #else
+         ///                                                                  
+         /// A group of 8 control bytes, probed in a 64-bit register          
+         ///                                                                  
+         struct CtrlGroup {
+            static constexpr size_t Width = 8;
+            static constexpr int Shift = 3;
+            static constexpr uint64_t Lsbs = 0x0101010101010101ull;
+            static constexpr uint64_t Msbs = 0x8080808080808080ull;
+            uint64_t _ctrl;
+
+            lgls_inline explicit CtrlGroup(const ctrl_t* ctrl) noexcept {
+               ::std::memcpy(&_ctrl, ctrl, sizeof(_ctrl));
+               if constexpr (::std::endian::native == ::std::endian::big)
+                  _ctrl = ::std::byteswap(_ctrl);
+            }
+
+            /// Slots whose control byte matches the hash tag. May report a   
+            /// false positive, but that is caught by the key comparison      
+            lgls_inline uint64_t Match(ctrl_t tag) const noexcept {
+               const auto x = _ctrl ^ (Lsbs * static_cast<uint8_t>(tag));
+               return (x - Lsbs) & ~x & Msbs;
+            }
+
+            lgls_inline uint64_t MatchEmpty() const noexcept {
+               return (_ctrl & (~_ctrl << 6)) & Msbs;
+            }
+
+            lgls_inline uint64_t MatchEmptyOrDeleted() const noexcept {
+               return _ctrl & Msbs;
+            }
+         };
+      #endif
+   }
+
+
+   ///                                                                        
+   /// An open-addressing hash map with literal_t keys stored inline          
+   ///                                                                        
+   /// Laid out like a SwissTable - one control byte per slot, holding seven  
+   /// bits of the hash, and probed a whole group at a time. Keys are kept    
+   /// zero-padded, so confirming a probe hit is a single whole-array         
+   /// compare, and nothing is ever allocated per key. Lookups accept         
+   /// anything convertible to a string view - literal_t, C arrays, views -   
+   /// and keys that don't fit in N characters are simply never found.        
+   ///                                                                        
+   template<size_t N, class V, class HASH = ::std::hash<literal_t<char, N>>>
+   class flat_literal_map {
+   public:
+      using key_type = literal_t<char, N>;
+      using mapped_type = V;
+      using value_type = ::std::pair<key_type, mapped_type>;
+      using size_type = size_t;
+      using hasher = HASH;
+      using view_type = typename key_type::view_type;
+      using Group = Inner::CtrlGroup;
+
+      template<bool CONST>
+      struct Iterator;
+      using iterator = Iterator<false>;
+      using const_iterator = Iterator<true>;
+
+      flat_literal_map() noexcept = default;
+
+      flat_literal_map(::std::initializer_list<value_type> list) {
+         reserve(list.size());
+         for (auto& pair : list)
+            insert(pair);
+      }
+
+      flat_literal_map(const flat_literal_map& other) : _hash {other._hash} {
+         reserve(other._size);
+         for (auto& pair : other)
+            Insert(pair.first, HashOf(pair.first), pair.second);
+      }
+
+      flat_literal_map(flat_literal_map&& other) noexcept {
+         swap(other);
+      }
+
+      ~flat_literal_map() {
+         Release();
+      }
+
+      flat_literal_map& operator = (flat_literal_map other) noexcept {
+         swap(other);
+         return *this;
+      }
+
+      void swap(flat_literal_map& other) noexcept {
+         ::std::swap(_ctrl, other._ctrl);
+         ::std::swap(_slots, other._slots);
+         ::std::swap(_capacity, other._capacity);
+         ::std::swap(_size, other._size);
+         ::std::swap(_growthLeft, other._growthLeft);
+         ::std::swap(_hash, other._hash);
+      }
+
+      ///                                                                     
+      /// Encapsulation                                                       
+      ///                                                                     
+      size_type size() const noexcept {
+         return _size;
+      }
+
+      bool empty() const noexcept {
+         return _size == 0;
+      }
+
+      size_type capacity() const noexcept {
+         return _capacity;
+      }
+
+      /// Make sure 'count' elements fit without rehashing                    
+      void reserve(size_type count) {
+         if (count > _size + _growthLeft)
+            Rehash(CapacityFor(count));
+      }
+
+      void clear() noexcept {
+         if (not _capacity)
+            return;
+         DestroySlots();
+         ::std::memset(_ctrl, Inner::CtrlEmpty, _capacity + Group::Width);
+         _size = 0;
+         _growthLeft = MaxLoad(_capacity);
+      }
+
+      ///                                                                     
+      /// Iteration                                                           
+      ///                                                                     
+      iterator begin() noexcept {
+         return {this, NextFull(0)};
+      }
+
+      iterator end() noexcept {
+         return {this, _capacity};
+      }
+
+      const_iterator begin() const noexcept {
+         return {this, NextFull(0)};
+      }
+
+      const_iterator end() const noexcept {
+         return {this, _capacity};
+      }
+
+      ///                                                                     
+      /// Search                                                              
+      ///                                                                     
+      iterator find(view_type key) noexcept {
+         return {this, Find(key)};
+      }
+
+      const_iterator find(view_type key) const noexcept {
+         return {this, Find(key)};
+      }
+
+      bool contains(view_type key) const noexcept {
+         return Find(key) != _capacity;
+      }
+
+      size_type count(view_type key) const noexcept {
+         return contains(key);
+      }
+
+      mapped_type& at(view_type key) {
+         const auto index = Find(key);
+         if (index == _capacity)
+            throw ::std::out_of_range("key not found in flat_literal_map");
+         return _slots[index].second;
+      }
+
+      const mapped_type& at(view_type key) const {
+         const auto index = Find(key);
+         if (index == _capacity)
+            throw ::std::out_of_range("key not found in flat_literal_map");
+         return _slots[index].second;
+      }
+
+      ///                                                                     
+      /// Look up many keys at once, hiding the cache misses of big tables    
+      ///                                                                     
+      /// Keys are processed in small batches - all of a batch is hashed,     
+      /// the control groups of all of it are prefetched, then the slots of   
+      /// the first candidates, and only then are the probes resolved. So     
+      /// instead of stalling on each miss in turn, the misses of a whole     
+      /// batch are in flight at the same time.                               
+      ///   @param keys - same-capacity literals to look up                   
+      ///   @param out - where the iterators go, end() for missing keys;      
+      ///      must be at least as big as keys                                
+      ///                                                                     
+      template<CT::LiteralSpan R>
+      void find_batch(const R& keys, ::std::span<iterator> out) lgls_has_assumptions {
+         lgls_assume(out.size() >= ::std::ranges::size(keys), "Not enough space for results");
+         FindBatch(keys, [&](size_type i, size_type index) noexcept {
+            out[i] = {this, index};
+         });
+      }
+
+      template<CT::LiteralSpan R>
+      void find_batch(const R& keys, ::std::span<const_iterator> out) const lgls_has_assumptions {
+         lgls_assume(out.size() >= ::std::ranges::size(keys), "Not enough space for results");
+         FindBatch(keys, [&](size_type i, size_type index) noexcept {
+            out[i] = {this, index};
+         });
+      }
+
+      ///                                                                     
+      /// Insertion                                                           
+      ///   @attention throws ::std::length_error if key doesn't fit in N     
+      ///                                                                     
+      template<class...A>
+      ::std::pair<iterator, bool> try_emplace(view_type key, A&&...args) {
+         const auto normalized = Normalize(key);
+         const auto hash = HashOf(normalized);
+         const auto found = Find(normalized, hash);
+         if (found != _capacity)
+            return {{this, found}, false};
+         return {{this, Insert(normalized, hash, ::std::forward<A>(args)...)}, true};
+      }
+
+      template<class M>
+      ::std::pair<iterator, bool> insert_or_assign(view_type key, M&& value) {
+         auto result = try_emplace(key, ::std::forward<M>(value));
+         if (not result.second)
+            result.first->second = ::std::forward<M>(value);
+         return result;
+      }
+
+      ::std::pair<iterator, bool> insert(const value_type& pair) {
+         return try_emplace(pair.first, pair.second);
+      }
+
+      ::std::pair<iterator, bool> insert(value_type&& pair) {
+         return try_emplace(pair.first, ::std::move(pair.second));
+      }
+
+      mapped_type& operator [] (view_type key) {
+         return try_emplace(key).first->second;
+      }
+
+      ///                                                                     
+      /// Removal                                                             
+      ///                                                                     
+      size_type erase(view_type key) noexcept {
+         const auto index = Find(key);
+         if (index == _capacity)
+            return 0;
+         EraseAt(index);
+         return 1;
+      }
+
+      iterator erase(const_iterator it) noexcept {
+         EraseAt(it._index);
+         return {this, NextFull(it._index + 1)};
+      }
+
+   private:
+      using Slot = value_type;
+      using Allocator = ::std::allocator<Slot>;
+
+      Inner::ctrl_t* _ctrl = nullptr;
+      Slot*     _slots = nullptr;
+      size_type _capacity = 0;
+      size_type _size = 0;
+      size_type _growthLeft = 0;
+      [[no_unique_address]] hasher _hash;
+
+      /// Tables are kept at most 7/8 full                                    
+      static constexpr size_type MaxLoad(size_type capacity) noexcept {
+         return capacity - capacity / 8;
+      }
+
+      static constexpr size_type CapacityFor(size_type count) noexcept {
+         const auto wanted = count + (count + 6) / 7;
+         return ::std::bit_ceil(wanted < Group::Width ? Group::Width : wanted);
+      }
+
+      /// Copy a key into zero-padded storage, so that it can be compared     
+      /// and hashed as a whole array                                         
+      static key_type Normalize(view_type key) {
+         return inplace_literal<char, N, Overflow::Throw> {key}.literal();
+      }
+
+      size_t HashOf(const key_type& key) const noexcept {
+         return static_cast<size_t>(_hash(key));
+      }
+
+      static constexpr Inner::ctrl_t Tag(size_t hash) noexcept {
+         return static_cast<Inner::ctrl_t>(hash & 0x7F);
+      }
+
+      /// Set a control byte, keeping the group-sized mirror of the first     
+      /// bytes at the end up to date, so groups can be loaded unaligned      
+      void SetCtrl(size_type index, Inner::ctrl_t tag) noexcept {
+         _ctrl[index] = tag;
+         if (index < Group::Width)
+            _ctrl[_capacity + index] = tag;
+      }
+
+      size_type Find(view_type key) const noexcept {
+         if (not _capacity or key.size() > N)
+            return _capacity;
+         const auto normalized = Normalize(key);
+         return Find(normalized, HashOf(normalized));
+      }
+
+      /// Probe group by group for a normalized key                           
+      size_type Find(const key_type& key, size_t hash) const noexcept {
+         if (not _capacity)
+            return _capacity;
+
+         const auto mask = _capacity - 1;
+         auto offset = (hash >> 7) & mask;
+         size_type step = 0;
+         while (true) {
+            const Group group {_ctrl + offset};
+            for (auto m = group.Match(Tag(hash)); m; m &= m - 1) {
+               const auto index = (offset + (::std::countr_zero(m) >> Group::Shift)) & mask;
+               if (_slots[index].first._data == key._data)
+                  return index;
+            }
+
+            if (group.MatchEmpty())
+               return _capacity;
+
+            step += Group::Width;
+            offset = (offset + step) & mask;
+         }
+      }
+
+      /// Keys looked up together by FindBatch - enough to keep the memory    
+      /// system busy, few enough to stay in L1                               
+      static constexpr size_type BatchSize = 32;
+
+      template<CT::LiteralSpan R, class F>
+      void FindBatch(const R& keys, F&& found) const noexcept {
+         using literal = ::std::ranges::range_value_t<R>;
+         static_assert(::std::same_as<typename literal::value_type, char>,
+            "flat_literal_map keys are char literals");
+         const ::std::span<const literal> data {keys};
+         if (not _capacity) {
+            for (size_type i = 0; i < data.size(); ++i)
+               found(i, _capacity);
+            return;
+         }
+
+         const auto mask = _capacity - 1;
+         key_type batch[BatchSize];
+         uint64_t hashes[BatchSize];
+         uint64_t matches[BatchSize];
+         bool ended[BatchSize];
+
+         for (size_type first = 0; first < data.size(); first += BatchSize) {
+            const auto count = ::std::min(BatchSize, data.size() - first);
+
+            // Normalize and hash the whole batch                       
+            // Keys that don't fit become empty ones, never found       
+            bool fits[BatchSize];
+            for (size_type i = 0; i < count; ++i) {
+               const view_type key = data[first + i];
+               fits[i] = key.size() <= N;
+               batch[i] = fits[i] ? Normalize(key) : key_type {};
+            }
+
+            if constexpr (::std::same_as<hasher, ::std::hash<key_type>> and sizeof(size_t) == 8) {
+               hash_batch(::std::span<const key_type> {batch, count},
+                  ::std::span<uint64_t> {hashes, count});
+            }
+            else for (size_type i = 0; i < count; ++i)
+               hashes[i] = HashOf(batch[i]);
+
+            for (size_type i = 0; i < count; ++i)
+               lgls_prefetch(_ctrl + ((hashes[i] >> 7) & mask));
+
+            // Match the tags, and prefetch the first candidate slots   
+            for (size_type i = 0; i < count; ++i) {
+               const auto offset = (hashes[i] >> 7) & mask;
+               const Group group {_ctrl + offset};
+               matches[i] = group.Match(Tag(hashes[i]));
+               ended[i] = group.MatchEmpty();
+               if (matches[i]) {
+                  lgls_prefetch(_slots + ((offset +
+                     (::std::countr_zero(matches[i]) >> Group::Shift)) & mask));
+               }
+            }
+
+            // Resolve - most keys are settled by their first group     
+            for (size_type i = 0; i < count; ++i) {
+               auto index = _capacity;
+               if (fits[i]) {
+                  const auto offset = (hashes[i] >> 7) & mask;
+                  for (auto m = matches[i]; m; m &= m - 1) {
+                     const auto candidate = (offset + (::std::countr_zero(m) >> Group::Shift)) & mask;
+                     if (_slots[candidate].first._data == batch[i]._data) {
+                        index = candidate;
+                        break;
+                     }
+                  }
+
+                  if (index == _capacity and not ended[i])
+                     index = Find(batch[i], hashes[i]);
+               }
+               found(first + i, index);
+            }
+         }
+      }
+
+      /// First slot on the probe sequence that is free for insertion         
+      size_type FindFree(size_t hash) const noexcept {
+         const auto mask = _capacity - 1;
+         auto offset = (hash >> 7) & mask;
+         size_type step = 0;
+         while (true) {
+            const auto m = Group {_ctrl + offset}.MatchEmptyOrDeleted();
+            if (m)
+               return (offset + (::std::countr_zero(m) >> Group::Shift)) & mask;
+
+            step += Group::Width;
+            offset = (offset + step) & mask;
+         }
+      }
+
+      /// Insert a key that is known not to be in the table                   
+      template<class...A>
+      size_type Insert(const key_type& key, size_t hash, A&&...args) {
+         if (not _capacity)
+            Rehash(CapacityFor(1));
+
+         auto index = FindFree(hash);
+         if (not _growthLeft and _ctrl[index] == Inner::CtrlEmpty) {
+            // Grow, or just drop tombstones if mostly erased           
+            Rehash(_size >= MaxLoad(_capacity) / 2 ? _capacity * 2 : _capacity);
+            index = FindFree(hash);
+         }
+
+         ::std::construct_at(_slots + index,
+            ::std::piecewise_construct,
+            ::std::forward_as_tuple(key),
+            ::std::forward_as_tuple(::std::forward<A>(args)...)
+         );
+
+         _growthLeft -= _ctrl[index] == Inner::CtrlEmpty;
+         SetCtrl(index, Tag(hash));
+         ++_size;
+         return index;
+      }
+
+      void EraseAt(size_type index) noexcept {
+         ::std::destroy_at(_slots + index);
+         SetCtrl(index, Inner::CtrlDeleted);
+         --_size;
+      }
+
+      /// Move everything into a fresh table, dropping tombstones             
+      void Rehash(size_type capacity) {
+         auto ctrl = ::std::make_unique<Inner::ctrl_t[]>(capacity + Group::Width);
+         auto slots = Allocator {}.allocate(capacity);
+         ::std::memset(ctrl.get(), Inner::CtrlEmpty, capacity + Group::Width);
+
+         flat_literal_map fresh;
+         fresh._hash = _hash;
+         fresh._capacity = capacity;
+         fresh._growthLeft = MaxLoad(capacity);
+         fresh._ctrl = ctrl.release();
+         fresh._slots = slots;
+
+         for (size_type i = 0; i < _capacity; ++i) {
+            if (_ctrl[i] < 0)
+               continue;
+
+            const auto hash = HashOf(_slots[i].first);
+            const auto index = fresh.FindFree(hash);
+            ::std::construct_at(fresh._slots + index, ::std::move(_slots[i]));
+            fresh.SetCtrl(index, Tag(hash));
+            --fresh._growthLeft;
+            ++fresh._size;
+         }
+
+         swap(fresh);
+      }
+
+      void DestroySlots() noexcept {
+         if constexpr (not ::std::is_trivially_destructible_v<Slot>) {
+            for (size_type i = 0; i < _capacity; ++i) {
+               if (_ctrl[i] >= 0)
+                  ::std::destroy_at(_slots + i);
+            }
+         }
+      }
+
+      void Release() noexcept {
+         if (not _capacity)
+            return;
+         DestroySlots();
+         Allocator {}.deallocate(_slots, _capacity);
+         delete[] _ctrl;
+      }
+
+      size_type NextFull(size_type index) const noexcept {
+         while (index < _capacity and _ctrl[index] < 0)
+            ++index;
+         return index;
+      }
+
+   public:
+      ///                                                                     
+      /// Forward iterator over the full slots                                
+      ///                                                                     
+      template<bool CONST>
+      struct Iterator {
+         using map_type = ::std::conditional_t<CONST, const flat_literal_map, flat_literal_map>;
+         using value_type = typename flat_literal_map::value_type;
+         using reference = ::std::conditional_t<CONST, const value_type&, value_type&>;
+         using pointer = ::std::conditional_t<CONST, const value_type*, value_type*>;
+         using difference_type = ptrdiff_t;
+         using iterator_category = ::std::forward_iterator_tag;
+
+         map_type* _map = nullptr;
+         size_type _index = 0;
+
+         Iterator() noexcept = default;
+         Iterator(map_type* map, size_type index) noexcept
+            : _map {map}, _index {index} {}
+
+         /// Mutable iterators convert to constant ones                       
+         operator Iterator<true>() const noexcept requires (not CONST) {
+            return {_map, _index};
+         }
+
+         reference operator * () const noexcept {
+            return _map->_slots[_index];
+         }
+
+         pointer operator -> () const noexcept {
+            return _map->_slots + _index;
+         }
+
+         Iterator& operator ++ () noexcept {
+            _index = _map->NextFull(_index + 1);
+            return *this;
+         }
+
+         Iterator operator ++ (int) noexcept {
+            auto backup = *this;
+            ++*this;
+            return backup;
+         }
+
+         bool operator == (const Iterator&) const noexcept = default;
+      };
+   };
+}
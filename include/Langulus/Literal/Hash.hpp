@@ -0,0 +1,44 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Hashing of literal_t - HashLiteral, and the std::hash and std::swap       
+/// support                                                                   
+///                                                                           
+#pragma once
+#include "Core.hpp"
+
+
+namespace Langulus
+{
+   /// Hash a string view the same way literal_t::hash() hashes its contents  
+   template<CT::LiteralChar T>
+   constexpr uint64_t HashLiteral(::std::basic_string_view<T> view) noexcept {
+      return Inner::HashView(view);
+   }
+}
+
+namespace std
+{
+   /// Swap two strings                                                       
+   template<::Langulus::CT::LiteralString S>
+   void swap(S& lhs, S& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+      lhs.swap(rhs);
+   }
+
+   ///                                                                        
+   /// Hash support                                                           
+   ///                                                                        
+   template<class C, size_t N>
+   struct hash<::Langulus::literal_t<C, N>> {
+      using argument_type = ::Langulus::literal_t<C, N>;
+
+      lgls_inline
+      size_t operator()(const argument_type& str) const noexcept {
+         return static_cast<size_t>(str.hash());
+      }
+   };
+}
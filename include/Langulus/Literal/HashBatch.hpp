@@ -0,0 +1,231 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Span.hpp"
+
+#if defined(__AVX512F__) and defined(__AVX512DQ__) and defined(__AVX512BW__)
+   #include <immintrin.h>
+   #define lgls_hash_lanes 8
+#elif defined(__AVX2__)
+   #include <immintrin.h>
+   #define lgls_hash_lanes 4
+#else
+   #define lgls_hash_lanes 1
+#endif
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      ///                                                                     
+      /// Computes literal_t::hash() for many same-capacity literals at once  
+      ///                                                                     
+      /// Relies on the fixed stride between literals - word j of each one    
+      /// is always at the same offset - and on zero-lane detection to mask   
+      /// everything past the terminators, exactly as Inner::Packed does.     
+      /// The number of contents bytes comes out of the masks for free, so    
+      /// every lane runs the same instructions, and words past a lane's      
+      /// terminator are blended away instead of branched over.               
+      ///                                                                     
+      template<class T, size_t N>
+      struct BatchHasher {
+         using literal = literal_t<T, N>;
+         using lane_t = ::std::make_unsigned_t<T>;
+
+         static constexpr size_t Bytes = N * sizeof(T);
+         static constexpr size_t Words = Bytes / 8;
+         static constexpr size_t Stride = sizeof(literal);
+         static constexpr uint64_t LaneBits = sizeof(T) * 8;
+         static constexpr uint64_t LaneLsbs = ~uint64_t {0} / static_cast<lane_t>(-1);
+         static constexpr uint64_t LaneMsbs = LaneLsbs << (LaneBits - 1);
+
+         /// Only whole words can be loaded without reading past a literal    
+         static constexpr bool Vectorizable = lgls_hash_lanes > 1
+            and Bytes >= 8 and Bytes % 8 == 0
+            and ::std::endian::native == ::std::endian::little;
+
+         lgls_inline static uint64_t Load(const literal* key, size_t word) noexcept {
+            uint64_t result;
+            ::std::memcpy(&result, reinterpret_cast<const char*>(key->_data.data()) + word * 8, 8);
+            return result;
+         }
+
+      #if lgls_hash_lanes == 8
+         static constexpr size_t Lanes = 8;
+         using vec = __m512i;
+
+         lgls_inline static vec Set(uint64_t v) noexcept {
+            return _mm512_set1_epi64(static_cast<long long>(v));
+         }
+
+         lgls_inline static vec Step(vec h, vec word) noexcept {
+            return _mm512_rol_epi64(_mm512_mullo_epi64(
+               _mm512_xor_si512(h, word), Set(0x87C37B91114253D5ull)), 31);
+         }
+
+         lgls_inline static vec Final(vec h) noexcept {
+            h = _mm512_xor_si512(h, _mm512_srli_epi64(h, 33));
+            h = _mm512_mullo_epi64(h, Set(0xFF51AFD7ED558CCDull));
+            h = _mm512_xor_si512(h, _mm512_srli_epi64(h, 33));
+            h = _mm512_mullo_epi64(h, Set(0xC4CEB9FE1A85EC53ull));
+            return _mm512_xor_si512(h, _mm512_srli_epi64(h, 33));
+         }
+
+         /// Hash 'Lanes' literals, starting at 'keys'                        
+         static void Hash(const literal* keys, uint64_t* out) noexcept {
+            const vec zero = _mm512_setzero_si512();
+            const vec one = Set(1);
+            vec words[Words];
+            vec bytes = zero;
+            __mmask8 alive = 0xFF;
+
+            for (size_t j = 0; j < Words; ++j) {
+               vec w = _mm512_set_epi64(
+                  Load(keys + 7, j), Load(keys + 6, j), Load(keys + 5, j), Load(keys + 4, j),
+                  Load(keys + 3, j), Load(keys + 2, j), Load(keys + 1, j), Load(keys + 0, j));
+
+               // Keep only the lanes before the first zero one         
+               const vec z = _mm512_and_si512(_mm512_andnot_si512(w,
+                  _mm512_sub_epi64(w, Set(LaneLsbs))), Set(LaneMsbs));
+               const vec low = _mm512_and_si512(z, _mm512_sub_epi64(zero, z));
+               const vec keep = _mm512_maskz_sub_epi64(alive,
+                  _mm512_srli_epi64(low, LaneBits - 1), one);
+
+               // Each kept byte is 0xFF, so their sum is 255 per byte  
+               const vec sad = _mm512_sad_epu8(keep, zero);
+               bytes = _mm512_add_epi64(bytes, _mm512_srli_epi64(
+                  _mm512_add_epi64(_mm512_add_epi64(sad, _mm512_srli_epi64(sad, 8)), one), 8));
+
+               words[j] = _mm512_and_si512(w, keep);
+               alive &= _mm512_cmpeq_epi64_mask(z, zero);
+            }
+
+            vec h = Step(_mm512_xor_si512(Set(HashSeed), bytes), words[0]);
+            for (size_t j = 1; j < Words; ++j) {
+               const auto active = _mm512_cmpgt_epi64_mask(bytes, Set(j * 8));
+               h = _mm512_mask_blend_epi64(active, h, Step(h, words[j]));
+            }
+
+            _mm512_storeu_si512(out, Final(h));
+         }
+      #elif lgls_hash_lanes == 4
+         static constexpr size_t Lanes = 4;
+         using vec = __m256i;
+
+         lgls_inline static vec Set(uint64_t v) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(v));
+         }
+
+         /// AVX2 has no 64-bit multiplication, so do it in 32-bit halves     
+         lgls_inline static vec Mul(vec a, vec b) noexcept {
+            const vec lo = _mm256_mul_epu32(a, b);
+            const vec cross = _mm256_add_epi64(
+               _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+               _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+            return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+         }
+
+         lgls_inline static vec Step(vec h, vec word) noexcept {
+            const vec x = Mul(_mm256_xor_si256(h, word), Set(0x87C37B91114253D5ull));
+            return _mm256_or_si256(_mm256_slli_epi64(x, 31), _mm256_srli_epi64(x, 33));
+         }
+
+         lgls_inline static vec Final(vec h) noexcept {
+            h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+            h = Mul(h, Set(0xFF51AFD7ED558CCDull));
+            h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+            h = Mul(h, Set(0xC4CEB9FE1A85EC53ull));
+            return _mm256_xor_si256(h, _mm256_srli_epi64(h, 33));
+         }
+
+         /// Hash 'Lanes' literals, starting at 'keys'                        
+         static void Hash(const literal* keys, uint64_t* out) noexcept {
+            const vec zero = _mm256_setzero_si256();
+            const vec one = Set(1);
+            vec words[Words];
+            vec bytes = zero;
+            vec alive = Set(~uint64_t {0});
+
+            for (size_t j = 0; j < Words; ++j) {
+               vec w = _mm256_set_epi64x(
+                  Load(keys + 3, j), Load(keys + 2, j), Load(keys + 1, j), Load(keys + 0, j));
+
+               // Keep only the lanes before the first zero one         
+               const vec z = _mm256_and_si256(_mm256_andnot_si256(w,
+                  _mm256_sub_epi64(w, Set(LaneLsbs))), Set(LaneMsbs));
+               const vec low = _mm256_and_si256(z, _mm256_sub_epi64(zero, z));
+               const vec keep = _mm256_and_si256(alive,
+                  _mm256_sub_epi64(_mm256_srli_epi64(low, LaneBits - 1), one));
+
+               // Each kept byte is 0xFF, so their sum is 255 per byte  
+               const vec sad = _mm256_sad_epu8(keep, zero);
+               bytes = _mm256_add_epi64(bytes, _mm256_srli_epi64(
+                  _mm256_add_epi64(_mm256_add_epi64(sad, _mm256_srli_epi64(sad, 8)), one), 8));
+
+               words[j] = _mm256_and_si256(w, keep);
+               alive = _mm256_and_si256(alive, _mm256_cmpeq_epi64(z, zero));
+            }
+
+            vec h = Step(_mm256_xor_si256(Set(HashSeed), bytes), words[0]);
+            for (size_t j = 1; j < Words; ++j) {
+               const vec active = _mm256_cmpgt_epi64(bytes, Set(j * 8));
+               h = _mm256_blendv_epi8(h, Step(h, words[j]), active);
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<vec*>(out), Final(h));
+         }
+      #else
+         static constexpr size_t Lanes = 1;
+
+         static void Hash(const literal* keys, uint64_t* out) noexcept {
+            *out = keys->hash();
+         }
+      #endif
+      };
+
+      /// The part of hash_batch that depends only on the literal type, so    
+      /// that it's instantiated once per literal_t, no matter the range      
+      template<class T, size_t N>
+      void HashBatch(::std::span<const literal_t<T, N>> keys, ::std::span<uint64_t> out) lgls_has_assumptions {
+         using Hasher = BatchHasher<T, N>;
+         lgls_assume(out.size() >= keys.size(), "Not enough space for hashes");
+
+         size_t i = 0;
+         if constexpr (Hasher::Vectorizable) {
+            for (; i + Hasher::Lanes <= keys.size(); i += Hasher::Lanes)
+               Hasher::Hash(keys.data() + i, out.data() + i);
+         }
+
+         for (; i < keys.size(); ++i)
+            out[i] = keys[i].hash();
+      }
+   }
+
+   ///                                                                        
+   /// Hash many same-capacity literals at once, with AVX-512 or AVX2 when    
+   /// enabled at compile time. Gives exactly the same values as calling      
+   /// literal_t::hash() on each of them, so batched and single lookups       
+   /// always agree.                                                          
+   ///   @param keys - the literals to hash                                   
+   ///   @param out - where hashes go, must be at least as big as keys        
+   ///                                                                        
+   template<CT::LiteralSpan R>
+   void hash_batch(const R& keys, ::std::span<uint64_t> out) lgls_has_assumptions {
+      using literal = ::std::ranges::range_value_t<R>;
+      Inner::HashBatch<typename literal::value_type, literal::ArraySize>(
+         ::std::span<const literal> {keys}, out);
+   }
+}
+
+#ifdef LANGULUS_OPTION_PREBUILT
+   #define lgls_prebuilt_literal(T, N) \
+      extern template void ::Langulus::Inner::HashBatch<T, N>( \
+         ::std::span<const ::Langulus::literal_t<T, N>>, ::std::span<uint64_t>) lgls_has_assumptions;
+   #include "Prebuilt.inl"
+#endif
@@ -0,0 +1,146 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+#include <string>
+
+
+namespace Langulus
+{
+   ///                                                                        
+   /// A string view that carries its hash along                              
+   ///                                                                        
+   /// Hashed once on construction - at compile time when constructed in a    
+   /// constant expression - with the same function as literal_t::hash()      
+   /// and HashLiteral(), so it can be used for lookups in any container      
+   /// that hashes with literal_hash.                                         
+   ///                                                                        
+   struct literal_key {
+      ::std::string_view view;
+      uint64_t hash;
+
+      constexpr literal_key(::std::string_view key) noexcept
+         : view {key}, hash {HashLiteral(key)} {}
+
+      constexpr literal_key(::std::string_view key, uint64_t precomputed) noexcept
+         : view {key}, hash {precomputed} {}
+
+      constexpr operator ::std::string_view () const noexcept {
+         return view;
+      }
+   };
+
+   ///                                                                        
+   /// A key whose hash is a compile-time constant                            
+   ///                                                                        
+   /// Empty - both the literal and its hash are static members - so passing  
+   /// one to find() costs nothing, and literal_hash just returns the         
+   /// constant, e.g.                                                         
+   ///   map.find(hashed_key<"config.timeout"> {});                           
+   ///                                                                        
+   template<literal_t L> requires CT::LiteralString<decltype(L)>
+   struct hashed_key {
+      using view_type = typename decltype(L)::view_type;
+
+      static constexpr auto literal = L;
+      static constexpr view_type view = static_cast<view_type>(L);
+      static constexpr uint64_t hash = L.hash();
+
+      constexpr operator view_type () const noexcept {
+         return view;
+      }
+
+      constexpr operator literal_key () const noexcept
+         requires ::std::same_as<view_type, ::std::string_view> {
+         return {view, hash};
+      }
+   };
+
+   namespace Inner
+   {
+      template<class T>
+      struct IsHashedKey : ::std::false_type {};
+
+      template<literal_t L>
+      struct IsHashedKey<hashed_key<L>> : ::std::true_type {};
+
+      /// Get the string view of anything literal_hash accepts                
+      template<CT::LiteralChar T>
+      constexpr ::std::basic_string_view<T> ViewOf(::std::basic_string_view<T> s) noexcept {
+         return s;
+      }
+
+      template<CT::LiteralChar T, class TR, class A>
+      constexpr ::std::basic_string_view<T> ViewOf(const ::std::basic_string<T, TR, A>& s) noexcept {
+         return s;
+      }
+
+      template<CT::LiteralChar T>
+      constexpr ::std::basic_string_view<T> ViewOf(const T* s) noexcept {
+         return s;
+      }
+
+      template<CT::LiteralString L>
+      constexpr auto ViewOf(const L& s) noexcept {
+         return static_cast<typename L::view_type>(s);
+      }
+
+      template<literal_t L>
+      constexpr auto ViewOf(hashed_key<L>) noexcept {
+         return hashed_key<L>::view;
+      }
+
+      constexpr ::std::string_view ViewOf(const literal_key& s) noexcept {
+         return s.view;
+      }
+   }
+
+   namespace CT
+   {
+      /// Anything literal_hash and literal_equal accept                      
+      template<class T>
+      concept HashableString = requires (const T& s) { ::Langulus::Inner::ViewOf(s); };
+   }
+
+   ///                                                                        
+   /// Transparent hasher for unordered containers of strings                 
+   ///                                                                        
+   /// Hashes strings, views, C strings and literal_t with HashLiteral, so    
+   /// all of them agree with each other, and takes precomputed hashes from   
+   /// literal_key and hashed_key as they are. With literal_equal it enables  
+   /// heterogeneous lookups, e.g.                                            
+   ///   ::std::unordered_map<::std::string, V, literal_hash, literal_equal>  
+   /// can be searched with a string_view or a hashed_key, without making     
+   /// a temporary ::std::string, or hashing anything at runtime.             
+   ///                                                                        
+   struct literal_hash {
+      using is_transparent = void;
+
+      template<CT::HashableString S>
+      constexpr size_t operator () (const S& s) const noexcept {
+         if constexpr (Inner::IsHashedKey<S>::value)
+            return static_cast<size_t>(S::hash);
+         else if constexpr (::std::same_as<S, literal_key>)
+            return static_cast<size_t>(s.hash);
+         else
+            return static_cast<size_t>(HashLiteral(Inner::ViewOf(s)));
+      }
+   };
+
+   ///                                                                        
+   /// Transparent equality for unordered containers of strings               
+   ///                                                                        
+   struct literal_equal {
+      using is_transparent = void;
+
+      template<CT::HashableString A, CT::HashableString B>
+      constexpr bool operator () (const A& a, const B& b) const noexcept {
+         return Inner::ViewOf(a) == Inner::ViewOf(b);
+      }
+   };
+}
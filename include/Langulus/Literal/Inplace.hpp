@@ -0,0 +1,203 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+#include <stdexcept>
+
+
+namespace Langulus
+{
+   /// What happens when runtime data doesn't fit in an inplace_literal       
+   enum class Overflow {
+      Truncate,   // Silently discard whatever doesn't fit, like operator +=
+      Throw       // Throw ::std::length_error, leaving contents unchanged
+   };
+
+
+   ///                                                                        
+   /// A fixed-capacity, heap-free runtime string built on top of literal_t   
+   ///                                                                        
+   /// Fills a literal_t from runtime data, such as a string_view off the     
+   /// wire, while tracking the length, so that size() is O(1). Everything    
+   /// past the length is always kept zeroed, so the underlying literal_t is  
+   /// indistinguishable from one made at compile time - it compares, hashes  
+   /// and searches identically, and can be passed wherever a                 
+   /// `const literal_t<T, N>&` is expected.                                  
+   ///                                                                        
+   template<CT::LiteralChar T, size_t N, Overflow POLICY = Overflow::Truncate>
+   struct inplace_literal : literal_t<T, N> {
+      static_assert(N > 0, "inplace_literal needs some capacity");
+      using Base = literal_t<T, N>;
+      using typename Base::value_type;
+      using typename Base::view_type;
+      using Base::npos;
+
+      static constexpr Overflow OverflowPolicy = POLICY;
+
+      size_t _size = 0;
+
+      constexpr inplace_literal() noexcept = default;
+
+      constexpr inplace_literal(view_type view) noexcept(POLICY != Overflow::Throw) {
+         assign(view);
+      }
+
+      constexpr inplace_literal(const value_type* s) noexcept(POLICY != Overflow::Throw)
+         : inplace_literal {view_type {s}} {}
+
+      template<size_t M>
+      constexpr inplace_literal(const literal_t<T, M>& other) noexcept(POLICY != Overflow::Throw or M <= N)
+         : inplace_literal {static_cast<view_type>(other)} {}
+
+      constexpr inplace_literal& operator = (view_type view) noexcept(POLICY != Overflow::Throw) {
+         return assign(view);
+      }
+
+      constexpr inplace_literal& operator = (const value_type* s) noexcept(POLICY != Overflow::Throw) {
+         return assign(view_type {s});
+      }
+
+      ///                                                                     
+      /// Encapsulation                                                       
+      ///                                                                     
+      static constexpr size_t capacity() noexcept {
+         return N;
+      }
+
+      static constexpr size_t max_size() noexcept {
+         return N;
+      }
+
+      constexpr size_t size() const noexcept {
+         return _size;
+      }
+
+      constexpr size_t length() const noexcept {
+         return _size;
+      }
+
+      constexpr bool empty() const noexcept {
+         return _size == 0;
+      }
+
+      constexpr bool full() const noexcept {
+         return _size == N;
+      }
+
+      constexpr explicit operator bool () const noexcept {
+         return _size != 0;
+      }
+
+      /// Implicit cast to a string view, without scanning for the terminator 
+      constexpr operator view_type() const noexcept {
+         return {this->_data.data(), _size};
+      }
+
+      /// Access the literal_t this inplace_literal is built on               
+      constexpr const Base& literal() const noexcept {
+         return *this;
+      }
+
+      ///                                                                     
+      /// Modification                                                        
+      ///                                                                     
+      /// Replace the contents with a copy of the view, and zero the rest -   
+      /// the view may point into this inplace_literal itself                 
+      constexpr inplace_literal& assign(view_type view) noexcept(POLICY != Overflow::Throw) {
+         const size_t count = fit(0, view.size());
+         using traits = ::std::char_traits<T>;
+         if consteval {
+            // Unrelated pointers can't be compared here, but a view    
+            // into this always starts at or after the destination      
+            for (size_t i = 0; i < count; ++i)
+               this->_data[i] = view[i];
+         }
+         else {
+            traits::move(this->_data.data(), view.data(), count);
+         }
+         traits::assign(this->_data.data() + count, N + 1 - count, value_type {});
+         _size = count;
+         return *this;
+      }
+
+      /// Append a view at the end                                            
+      constexpr inplace_literal& append(view_type view) noexcept(POLICY != Overflow::Throw) {
+         const size_t count = fit(_size, view.size());
+         ::std::char_traits<T>::copy(this->_data.data() + _size, view.data(), count);
+         _size += count;
+         return *this;
+      }
+
+      /// Append a single character at the end                                
+      constexpr inplace_literal& push_back(value_type c) noexcept(POLICY != Overflow::Throw) {
+         if (fit(_size, 1))
+            this->_data[_size++] = c;
+         return *this;
+      }
+
+      /// Remove the last character, if any                                   
+      constexpr void pop_back() noexcept {
+         if (_size)
+            this->_data[--_size] = value_type {};
+      }
+
+      /// Shrink the string, or grow it by filling with the given character   
+      constexpr void resize(size_t count, value_type c = {}) noexcept(POLICY != Overflow::Throw) {
+         if (count < _size) {
+            ::std::char_traits<T>::assign(this->_data.data() + count, _size - count, value_type {});
+            _size = count;
+         }
+         else {
+            const size_t extra = fit(_size, count - _size);
+            ::std::char_traits<T>::assign(this->_data.data() + _size, extra, c);
+            _size += extra;
+         }
+      }
+
+      constexpr void clear() noexcept {
+         ::std::char_traits<T>::assign(this->_data.data(), _size, value_type {});
+         _size = 0;
+      }
+
+      constexpr inplace_literal& operator += (view_type view) noexcept(POLICY != Overflow::Throw) {
+         return append(view);
+      }
+
+      constexpr inplace_literal& operator += (value_type c) noexcept(POLICY != Overflow::Throw) {
+         return push_back(c);
+      }
+
+      void swap(inplace_literal& other) noexcept {
+         this->_data.swap(other._data);
+         ::std::swap(_size, other._size);
+      }
+
+   private:
+      /// Apply the overflow policy, when appending 'count' characters at     
+      /// 'offset', and return how many of them actually fit                  
+      static constexpr size_t fit(size_t offset, size_t count) noexcept(POLICY != Overflow::Throw) {
+         if (count <= N - offset)
+            return count;
+
+         if constexpr (POLICY == Overflow::Throw)
+            throw ::std::length_error("inplace_literal capacity exceeded");
+         else
+            return N - offset;
+      }
+   };
+}
+
+namespace std
+{
+   ///                                                                        
+   /// Hash support - identical to the hash of the underlying literal_t       
+   ///                                                                        
+   template<class C, size_t N, ::Langulus::Overflow P>
+   struct hash<::Langulus::inplace_literal<C, N, P>>
+      : hash<::Langulus::literal_t<C, N>> {};
+}
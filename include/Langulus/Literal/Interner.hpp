@@ -0,0 +1,258 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+#include <atomic>
+#include <new>
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      ///                                                                     
+      /// An interned string - immutable, and never freed                     
+      ///                                                                     
+      struct InternEntry {
+         uint64_t hash;
+         size_t size;
+         const char* data;
+
+         constexpr ::std::string_view view() const noexcept {
+            return {data, size};
+         }
+
+         bool Is(::std::string_view s, uint64_t h) const noexcept {
+            return hash == h and size == s.size()
+               and ::std::char_traits<char>::compare(data, s.data(), size) == 0;
+         }
+      };
+
+      /// One table in the interner's chain                                   
+      struct InternTable {
+         ::std::atomic<const InternEntry*>* slots;
+         size_t mask;
+         ::std::atomic<InternTable*> next;
+      };
+
+      ///                                                                     
+      /// The global, lock-free string interner                               
+      ///                                                                     
+      /// A chain of open-addressing tables of entry pointers. A slot goes    
+      /// from null to an entry exactly once, and entries never move, so:     
+      ///   - lookups are wait-free - a few acquire loads per table, and no   
+      ///     writes to shared memory at all, so readers never contend;       
+      ///   - insertions claim the first null slot in the string's probe      
+      ///     window with a CAS, and on losing the race just look at what     
+      ///     won, so two threads interning the same string always agree;     
+      ///   - when a window is all taken, the string goes to the next         
+      ///     table, twice as big, allocated on demand. A window never        
+      ///     frees up again, so a lookup can stop at the first window        
+      ///     with a null slot.                                               
+      /// The root table is constinit, so interning works even during static  
+      /// initialization, in any order.                                       
+      ///                                                                     
+      class Interner {
+      public:
+         /// Slots probed in each table, before moving to the next one        
+         static constexpr size_t Window = 32;
+         static constexpr size_t RootCapacity = 4096;
+
+         /// Find an interned string, or nullptr                              
+         static const InternEntry* Find(::std::string_view s, uint64_t hash) noexcept {
+            for (auto table = &Root; table; table = table->next.load(::std::memory_order_acquire)) {
+               for (size_t i = 0; i < Window; ++i) {
+                  const auto entry = table->slots[(hash + i) & table->mask]
+                     .load(::std::memory_order_acquire);
+                  if (not entry)
+                     return nullptr;
+                  if (entry->Is(s, hash))
+                     return entry;
+               }
+            }
+            return nullptr;
+         }
+
+         /// Insert an entry, unless one with the same string is already in;  
+         /// returns whichever ends up interned                               
+         static const InternEntry* Insert(const InternEntry* fresh) {
+            const auto s = fresh->view();
+            for (auto table = &Root; ; table = Next(table)) {
+               for (size_t i = 0; i < Window; ++i) {
+                  auto& slot = table->slots[(fresh->hash + i) & table->mask];
+                  auto entry = slot.load(::std::memory_order_acquire);
+                  if (not entry and slot.compare_exchange_strong(entry, fresh,
+                        ::std::memory_order_acq_rel, ::std::memory_order_acquire))
+                     return fresh;
+                  if (entry->Is(s, fresh->hash))
+                     return entry;
+               }
+            }
+         }
+
+         /// Copy a runtime string into a new entry                           
+         static const InternEntry* Make(::std::string_view s, uint64_t hash) {
+            const auto raw = static_cast<char*>(::operator new(sizeof(InternEntry) + s.size() + 1));
+            const auto data = raw + sizeof(InternEntry);
+            ::std::char_traits<char>::copy(data, s.data(), s.size());
+            data[s.size()] = '\0';
+            return ::new (raw) InternEntry {hash, s.size(), data};
+         }
+
+         /// Free an entry made by Make, that lost an insertion race          
+         static void Discard(const InternEntry* entry) noexcept {
+            ::operator delete(const_cast<InternEntry*>(entry));
+         }
+
+      private:
+         static inline constinit ::std::atomic<const InternEntry*> RootSlots[RootCapacity] {};
+         static inline constinit InternTable Root {RootSlots, RootCapacity - 1, nullptr};
+
+         /// Get the table after this one, making it if there's none yet.     
+         /// Tables are never freed, just like the entries                    
+         static InternTable* Next(InternTable* table) {
+            if (auto next = table->next.load(::std::memory_order_acquire))
+               return next;
+
+            const auto capacity = (table->mask + 1) * 2;
+            auto fresh = new InternTable {
+               new ::std::atomic<const InternEntry*>[capacity] {}, capacity - 1, nullptr
+            };
+
+            InternTable* next = nullptr;
+            if (table->next.compare_exchange_strong(next, fresh,
+                  ::std::memory_order_acq_rel, ::std::memory_order_acquire))
+               return fresh;
+
+            delete[] fresh->slots;
+            delete fresh;
+            return next;
+         }
+      };
+
+      /// Entry of a compile-time literal - constant initialized, pointing    
+      /// straight into the template parameter object                         
+      template<literal_t L>
+      inline constinit InternEntry StaticEntry {L.hash(), L.size(), L._data.data()};
+
+      /// Whatever StaticEntry<L> resolved to when it was interned            
+      template<literal_t L>
+      inline constinit ::std::atomic<const InternEntry*> Seeded {nullptr};
+
+      /// Interns every literal used with intern<L>() during static           
+      /// initialization, so that it's all done before main                   
+      template<literal_t L>
+      inline const bool Registered = (Seeded<L>.store(
+         Interner::Insert(&StaticEntry<L>), ::std::memory_order_release), true);
+   }
+
+
+   ///                                                                        
+   /// A handle to an interned string                                         
+   ///                                                                        
+   /// The same string always gets the same handle, whether it was interned   
+   /// from a literal_t template argument, or from a string that arrived at   
+   /// runtime, so handles compare as plain integers. Handles are valid for   
+   /// the lifetime of the program, as are the strings they point to.         
+   ///   @attention the default handle is distinct from intern("")            
+   ///                                                                        
+   class interned {
+      const Inner::InternEntry* _entry = nullptr;
+
+   public:
+      constexpr interned() noexcept = default;
+      constexpr explicit interned(const Inner::InternEntry* entry) noexcept
+         : _entry {entry} {}
+
+      /// The integer handles are compared by                                 
+      uintptr_t id() const noexcept {
+         return reinterpret_cast<uintptr_t>(_entry);
+      }
+
+      /// Same as literal_t::hash() and HashLiteral() of the string           
+      constexpr uint64_t hash() const noexcept {
+         return _entry ? _entry->hash : HashLiteral(::std::string_view {});
+      }
+
+      constexpr ::std::string_view view() const noexcept {
+         return _entry ? _entry->view() : ::std::string_view {};
+      }
+
+      /// Interned strings are always null-terminated                         
+      constexpr const char* c_str() const noexcept {
+         return _entry ? _entry->data : "";
+      }
+
+      constexpr size_t size() const noexcept {
+         return _entry ? _entry->size : 0;
+      }
+
+      constexpr operator ::std::string_view () const noexcept {
+         return view();
+      }
+
+      constexpr explicit operator bool () const noexcept {
+         return _entry;
+      }
+
+      constexpr bool operator == (const interned&) const noexcept = default;
+
+      ::std::strong_ordering operator <=> (const interned& rhs) const noexcept {
+         return id() <=> rhs.id();
+      }
+   };
+
+   /// Intern a runtime string                                                
+   inline interned intern(::std::string_view s) {
+      const auto hash = HashLiteral(s);
+      if (auto found = Inner::Interner::Find(s, hash))
+         return interned {found};
+
+      const auto fresh = Inner::Interner::Make(s, hash);
+      const auto result = Inner::Interner::Insert(fresh);
+      if (result != fresh)
+         Inner::Interner::Discard(fresh);
+      return interned {result};
+   }
+
+   /// Intern a compile-time literal - it has already been interned before    
+   /// main, so this is a single load                                         
+   template<literal_t L>
+      requires ::std::same_as<typename decltype(L)::value_type, char>
+   interned intern() {
+      static_cast<void>(Inner::Registered<L>);
+      if (auto seeded = Inner::Seeded<L>.load(::std::memory_order_acquire))
+         return interned {seeded};
+
+      // Called during static initialization, before being registered   
+      const auto result = Inner::Interner::Insert(&Inner::StaticEntry<L>);
+      Inner::Seeded<L>.store(result, ::std::memory_order_release);
+      return interned {result};
+   }
+
+   /// Find a string, if it was interned, without interning it - wait-free    
+   inline interned find_interned(::std::string_view s) noexcept {
+      return interned {Inner::Interner::Find(s, HashLiteral(s))};
+   }
+}
+
+namespace std
+{
+   ///                                                                        
+   /// Hash support - the hash of the interned string                         
+   ///                                                                        
+   template<>
+   struct hash<::Langulus::interned> {
+      using argument_type = ::Langulus::interned;
+
+      lgls_inline
+      size_t operator()(const argument_type& str) const noexcept {
+         return static_cast<size_t>(str.hash());
+      }
+   };
+}
@@ -0,0 +1,746 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Sid.hpp"
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      /// How each argument is stored - scalars always take 8 bytes, strings  
+      /// take a 4-byte length and the characters                             
+      enum class LogKind : uint8_t {
+         Bool = 1, Char, Signed, Unsigned, Float, Pointer, String
+      };
+
+      template<class T>
+      consteval LogKind LogKindOf() {
+         if constexpr (::std::is_enum_v<T>)
+            return LogKindOf<::std::underlying_type_t<T>>();
+         else if constexpr (::std::same_as<T, bool>)
+            return LogKind::Bool;
+         else if constexpr (::std::same_as<T, char>)
+            return LogKind::Char;
+         else if constexpr (::std::signed_integral<T>)
+            return LogKind::Signed;
+         else if constexpr (::std::unsigned_integral<T>)
+            return LogKind::Unsigned;
+         else if constexpr (::std::floating_point<T>)
+            return LogKind::Float;
+         else if constexpr (::std::constructible_from<::std::string_view, const T&>)
+            return LogKind::String;
+         else if constexpr (::std::is_pointer_v<T> or ::std::is_null_pointer_v<T>)
+            return LogKind::Pointer;
+         else
+            static_assert(sizeof(T) == 0, "Unsupported log argument type");
+      }
+
+      /// Number of {} in a format, with {{ and }} being escaped braces.      
+      /// Returns -1 for unmatched braces                                     
+      consteval int LogPlaceholders(::std::string_view format) {
+         int count = 0;
+         for (size_t i = 0; i < format.size(); ++i) {
+            if (format[i] == '{') {
+               if (i + 1 == format.size())
+                  return -1;
+               if (format[i + 1] == '}')
+                  ++count;
+               else if (format[i + 1] != '{')
+                  return -1;
+               ++i;
+            }
+            else if (format[i] == '}') {
+               if (i + 1 == format.size() or format[i + 1] != '}')
+                  return -1;
+               ++i;
+            }
+         }
+         return count;
+      }
+
+      ///                                                                     
+      /// A log call site's format - the format string and argument layout,   
+      /// identified by a stable hash of both, so it can be decoded offline   
+      ///                                                                     
+      struct LogFormat {
+         uint32_t id;
+         ::std::string_view format;
+         const LogKind* kinds;
+         uint32_t count;
+         LogFormat* next;
+      };
+
+      /// Header of a record, in the buffers and in log files                 
+      struct LogHeader {
+         uint32_t format;
+         uint32_t size;
+         int64_t time;
+      };
+
+      /// Get the characters of a string argument                             
+      template<class T>
+      ::std::string_view LogString(const T& arg) noexcept {
+         if constexpr (::std::is_pointer_v<T>)
+            return arg ? ::std::string_view {arg} : ::std::string_view {"(null)"};
+         else
+            return static_cast<::std::string_view>(arg);
+      }
+
+      template<class T>
+      size_t LogSize(const T& arg) noexcept {
+         if constexpr (LogKindOf<T>() == LogKind::String)
+            return sizeof(uint32_t) + LogString(arg).size();
+         else
+            return sizeof(uint64_t);
+      }
+
+      template<class T>
+      ::std::byte* LogWrite(::std::byte* at, const T& arg) noexcept {
+         constexpr auto kind = LogKindOf<T>();
+         if constexpr (kind == LogKind::String) {
+            const auto s = LogString(arg);
+            const auto size = static_cast<uint32_t>(s.size());
+            ::std::memcpy(at, &size, sizeof(size));
+            ::std::memcpy(at + sizeof(size), s.data(), s.size());
+            return at + sizeof(size) + s.size();
+         }
+         else {
+            uint64_t raw;
+            if constexpr (kind == LogKind::Float) {
+               const double value = arg;
+               ::std::memcpy(&raw, &value, sizeof(raw));
+            }
+            else if constexpr (kind == LogKind::Pointer)
+               raw = reinterpret_cast<uintptr_t>(arg);
+            else if constexpr (kind == LogKind::Signed)
+               raw = static_cast<uint64_t>(static_cast<int64_t>(arg));
+            else
+               raw = static_cast<uint64_t>(arg);
+            ::std::memcpy(at, &raw, sizeof(raw));
+            return at + sizeof(raw);
+         }
+      }
+
+      ///                                                                     
+      /// A single-producer, single-consumer ring of variable-sized records,  
+      /// one per thread                                                      
+      ///                                                                     
+      /// Records are 16-byte aligned, and never wrap around - when one       
+      /// doesn't fit before the end, the rest is skipped with a padding      
+      /// record. When the ring is full the producer waits for the drain,     
+      /// so nothing is lost while a sink is open.                            
+      ///                                                                     
+      struct LogBuffer {
+         static constexpr size_t Capacity = 1 << 20;
+         static constexpr uint32_t Padding = 0;
+
+         alignas(16) ::std::byte data[Capacity];
+
+         alignas(64) ::std::atomic<uint64_t> head {};
+         uint64_t cachedTail = 0;
+
+         alignas(64) ::std::atomic<uint64_t> tail {};
+         ::std::atomic<bool> owned {true};
+         LogBuffer* next = nullptr;
+
+         static constexpr size_t Align(size_t size) noexcept {
+            return (size + 15) & ~size_t {15};
+         }
+      };
+
+      ///                                                                     
+      /// An open log_writer or log_recorder, as seen by the drain            
+      ///                                                                     
+      struct LogSink {
+         void* owner;
+         void (*record)(void* owner, const LogHeader&, const ::std::byte* payload);
+         void (*flush)(void* owner);
+         LogSink* next = nullptr;
+      };
+
+      ///                                                                     
+      /// All log buffers, formats and sinks in the program                   
+      ///                                                                     
+      class Logger {
+         static inline constinit ::std::atomic<LogBuffer*> Buffers {nullptr};
+         static inline constinit ::std::atomic<LogFormat*> Formats {nullptr};
+         static inline constinit ::std::atomic<int> Sinks {0};
+         static inline constinit LogSink* SinkList = nullptr;
+         static inline constinit ::std::mutex DrainMutex;
+         static inline thread_local constinit LogBuffer* Current = nullptr;
+
+         struct Owner {
+            LogBuffer* buffer = nullptr;
+
+            ~Owner() {
+               if (buffer)
+                  buffer->owned.store(false, ::std::memory_order_release);
+            }
+         };
+
+         static LogBuffer* Acquire() {
+            for (auto b = Buffers.load(::std::memory_order_acquire); b; b = b->next) {
+               bool owned = false;
+               if (b->head.load(::std::memory_order_relaxed) == b->tail.load(::std::memory_order_acquire)
+               and b->owned.compare_exchange_strong(owned, true, ::std::memory_order_acquire))
+                  return b;
+            }
+
+            auto b = new LogBuffer;
+            b->next = Buffers.load(::std::memory_order_relaxed);
+            while (not Buffers.compare_exchange_weak(b->next, b,
+               ::std::memory_order_release, ::std::memory_order_relaxed));
+            return b;
+         }
+
+         static LogBuffer* Own() noexcept {
+            thread_local Owner owner;
+            try { owner.buffer = Acquire(); }
+            catch (...) { return nullptr; }
+            return Current = owner.buffer;
+         }
+
+         /// Wait until 'size' bytes fit, returns false if the sinks went     
+         /// away while waiting                                               
+         static bool Reserve(LogBuffer& b, uint64_t h, size_t size) noexcept {
+            while (h + size - b.cachedTail > LogBuffer::Capacity) {
+               b.cachedTail = b.tail.load(::std::memory_order_acquire);
+               if (h + size - b.cachedTail <= LogBuffer::Capacity)
+                  break;
+               if (not Enabled())
+                  return false;
+               ::std::this_thread::yield();
+            }
+            return true;
+         }
+
+         /// Throw away everything in the buffers, while no sink is open.     
+         /// Threads that saw Enabled() just before the last sink closed may  
+         /// still write afterwards - those records belong to no sink, and    
+         /// would otherwise reach the next one. Called under DrainMutex      
+         static void Discard() noexcept {
+            for (auto b = Buffers.load(::std::memory_order_acquire); b; b = b->next)
+               b->tail.store(b->head.load(::std::memory_order_acquire), ::std::memory_order_release);
+         }
+
+      public:
+         static bool Register(LogFormat* format) noexcept {
+            format->next = Formats.load(::std::memory_order_relaxed);
+            while (not Formats.compare_exchange_weak(format->next, format,
+               ::std::memory_order_release, ::std::memory_order_relaxed));
+            return true;
+         }
+
+         lgls_inline static bool Enabled() noexcept {
+            return Sinks.load(::std::memory_order_relaxed) > 0;
+         }
+
+         /// Start sending records to a sink, along with any other open ones. 
+         /// A sink never gets records written before it opened               
+         static void Attach(LogSink& sink) {
+            ::std::scoped_lock lock {DrainMutex};
+            if (not SinkList)
+               Discard();
+            sink.next = SinkList;
+            SinkList = &sink;
+            Sinks.fetch_add(1, ::std::memory_order_relaxed);
+         }
+
+         /// Stop sending records to a sink, once no drain is using it        
+         static void Detach(LogSink& sink) {
+            ::std::scoped_lock lock {DrainMutex};
+            for (auto link = &SinkList; *link; link = &(*link)->next) {
+               if (*link == &sink) {
+                  *link = sink.next;
+                  break;
+               }
+            }
+            Sinks.fetch_sub(1, ::std::memory_order_relaxed);
+            if (not SinkList)
+               Discard();
+         }
+
+         static const LogFormat* FindFormat(uint32_t id) noexcept {
+            for (auto f = Formats.load(::std::memory_order_acquire); f; f = f->next) {
+               if (f->id == id)
+                  return f;
+            }
+            return nullptr;
+         }
+
+         /// Copy a record into the calling thread's buffer                   
+         template<class...A>
+         static void Write(uint32_t format, const A&...args) noexcept {
+            auto b = Current;
+            if (not b) [[unlikely]] {
+               b = Own();
+               if (not b)
+                  return;
+            }
+
+            const size_t payload = (size_t {0} + ... + LogSize(args));
+            const size_t size = LogBuffer::Align(sizeof(LogHeader) + payload);
+            if (size > LogBuffer::Capacity / 2) [[unlikely]]
+               return;
+
+            auto h = b->head.load(::std::memory_order_relaxed);
+            const auto offset = h & (LogBuffer::Capacity - 1);
+            if (offset + size > LogBuffer::Capacity) {
+               // Doesn't fit before the end, so pad the rest           
+               const auto padding = LogBuffer::Capacity - offset;
+               if (not Reserve(*b, h, padding + size))
+                  return;
+               const LogHeader pad {LogBuffer::Padding, static_cast<uint32_t>(padding), 0};
+               ::std::memcpy(b->data + offset, &pad, sizeof(pad));
+               h += padding;
+            }
+            else if (not Reserve(*b, h, size))
+               return;
+
+            const auto at = b->data + (h & (LogBuffer::Capacity - 1));
+            const LogHeader header {
+               format, static_cast<uint32_t>(payload),
+               ::std::chrono::system_clock::now().time_since_epoch()
+                  / ::std::chrono::nanoseconds {1}
+            };
+            ::std::memcpy(at, &header, sizeof(header));
+            auto cursor = at + sizeof(header);
+            ((cursor = LogWrite(cursor, args)), ...);
+            b->head.store(h + size, ::std::memory_order_release);
+         }
+
+         ///                                                                  
+         /// Take out all records written so far, ordered by time, and give   
+         /// each of them to every open sink. Drains are serialized, so any   
+         /// sink's thread may run one, and each record is taken out once     
+         ///   @return the number of records                                  
+         ///                                                                  
+         static size_t Drain() {
+            struct Found {
+               LogHeader header;
+               const ::std::byte* payload;
+            };
+            ::std::scoped_lock lock {DrainMutex};
+            thread_local ::std::vector<Found> found;
+            thread_local ::std::vector<::std::pair<LogBuffer*, uint64_t>> heads;
+            found.clear();
+            heads.clear();
+
+            for (auto b = Buffers.load(::std::memory_order_acquire); b; b = b->next) {
+               const auto h = b->head.load(::std::memory_order_acquire);
+               for (auto t = b->tail.load(::std::memory_order_relaxed); t != h; ) {
+                  const auto at = b->data + (t & (LogBuffer::Capacity - 1));
+                  LogHeader header;
+                  ::std::memcpy(&header, at, sizeof(header));
+                  if (header.format == LogBuffer::Padding)
+                     t += header.size;
+                  else {
+                     found.push_back({header, at + sizeof(LogHeader)});
+                     t += LogBuffer::Align(sizeof(LogHeader) + header.size);
+                  }
+               }
+               heads.emplace_back(b, h);
+            }
+
+            ::std::ranges::stable_sort(found, {}, [](const Found& r) { return r.header.time; });
+            for (auto& r : found) {
+               for (auto sink = SinkList; sink; sink = sink->next)
+                  sink->record(sink->owner, r.header, r.payload);
+            }
+
+            if (not found.empty()) {
+               for (auto sink = SinkList; sink; sink = sink->next)
+                  sink->flush(sink->owner);
+            }
+
+            for (auto [b, h] : heads)
+               b->tail.store(h, ::std::memory_order_release);
+            return found.size();
+         }
+      };
+
+      template<literal_t FORMAT, LogKind...KINDS>
+      struct LogSite {
+         static constexpr LogKind Kinds[sizeof...(KINDS) + 1] {KINDS..., LogKind {}};
+
+         /// Hash of the format and layout - the same format used with        
+         /// different argument types gets different IDs                      
+         static consteval uint32_t Id() {
+            constexpr ::std::string_view format = FORMAT;
+            ::std::array<char, format.size() + sizeof...(KINDS)> bytes {};
+            for (size_t i = 0; i < format.size(); ++i)
+               bytes[i] = format[i];
+            for (size_t i = 0; i < sizeof...(KINDS); ++i)
+               bytes[format.size() + i] = static_cast<char>(Kinds[i]);
+
+            // Zero is reserved for dictionary entries in log files     
+            const auto h = SidV1({bytes.data(), bytes.size()});
+            const auto id = static_cast<uint32_t>(h ^ (h >> 32));
+            return id ? id : 1;
+         }
+
+         static constexpr uint32_t id = Id();
+         static inline constinit LogFormat Format {
+            id, FORMAT, Kinds, sizeof...(KINDS), nullptr
+         };
+         static inline const bool Registered = Logger::Register(&Format);
+      };
+
+      /// Write a timestamp in nanoseconds since the epoch, as UTC            
+      inline void LogTime(::std::string& out, int64_t ns) {
+         using namespace ::std::chrono;
+         const sys_time<nanoseconds> time {nanoseconds {ns}};
+         const auto day = floor<days>(time);
+         const year_month_day date {day};
+         const hh_mm_ss clock {floor<microseconds>(time - day)};
+
+         char buffer[40];
+         const auto length = ::std::snprintf(buffer, sizeof(buffer),
+            "%04d-%02u-%02u %02d:%02d:%02d.%06d ",
+            static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
+            static_cast<unsigned>(date.day()), static_cast<int>(clock.hours().count()),
+            static_cast<int>(clock.minutes().count()), static_cast<int>(clock.seconds().count()),
+            static_cast<int>(clock.subseconds().count()));
+         out.append(buffer, length);
+      }
+
+      ///                                                                     
+      /// Format a record into a line of text, the same way whether it's      
+      /// done live or offline                                                
+      ///                                                                     
+      inline void LogFormatRecord(::std::string& out, ::std::string_view format,
+         const LogKind* kinds, uint32_t count, int64_t time, const ::std::byte* payload, size_t size
+      ) {
+         LogTime(out, time);
+
+         const auto end = payload + size;
+         uint32_t arg = 0;
+         char buffer[32];
+         for (size_t i = 0; i < format.size(); ++i) {
+            const char c = format[i];
+            if ((c == '{' or c == '}') and i + 1 < format.size() and format[i + 1] == c) {
+               out += c;
+               ++i;
+               continue;
+            }
+
+            if (c != '{' or i + 1 >= format.size() or format[i + 1] != '}' or arg >= count) {
+               out += c;
+               continue;
+            }
+
+            ++i;
+            const auto kind = kinds[arg++];
+            if (kind == LogKind::String) {
+               uint32_t length = 0;
+               if (payload + sizeof(length) > end)
+                  break;
+               ::std::memcpy(&length, payload, sizeof(length));
+               payload += sizeof(length);
+               length = static_cast<uint32_t>(::std::min<size_t>(length, end - payload));
+               out.append(reinterpret_cast<const char*>(payload), length);
+               payload += length;
+               continue;
+            }
+
+            uint64_t raw = 0;
+            if (payload + sizeof(raw) > end)
+               break;
+            ::std::memcpy(&raw, payload, sizeof(raw));
+            payload += sizeof(raw);
+
+            ::std::to_chars_result result {buffer, {}};
+            switch (kind) {
+            case LogKind::Bool:
+               out += raw ? "true" : "false";
+               break;
+            case LogKind::Char:
+               out += static_cast<char>(raw);
+               break;
+            case LogKind::Signed:
+               result = ::std::to_chars(buffer, buffer + sizeof(buffer), static_cast<int64_t>(raw));
+               break;
+            case LogKind::Unsigned:
+               result = ::std::to_chars(buffer, buffer + sizeof(buffer), raw);
+               break;
+            case LogKind::Float: {
+               double value;
+               ::std::memcpy(&value, &raw, sizeof(value));
+               result = ::std::to_chars(buffer, buffer + sizeof(buffer), value);
+               break;
+            }
+            case LogKind::Pointer:
+               out += "0x";
+               result = ::std::to_chars(buffer, buffer + sizeof(buffer), raw, 16);
+               break;
+            default:
+               break;
+            }
+            out.append(buffer, result.ptr);
+         }
+         out += '\n';
+      }
+
+      ///                                                                     
+      /// Runs a drain in the background, as long as there is work            
+      ///                                                                     
+      class LogDrainThread {
+         ::std::jthread _thread;
+         LogSink* _sink = nullptr;
+
+      public:
+         void Start(LogSink& sink, ::std::chrono::milliseconds period) {
+            Logger::Attach(sink);
+            _sink = &sink;
+            try {
+               _thread = ::std::jthread {[period](::std::stop_token stop) {
+                  ::std::mutex mutex;
+                  ::std::condition_variable_any wake;
+                  ::std::unique_lock lock {mutex};
+                  while (not stop.stop_requested()) {
+                     if (not Logger::Drain())
+                        wake.wait_for(lock, stop, period, [] { return false; });
+                  }
+               }};
+            }
+            catch (...) {
+               Logger::Detach(sink);
+               throw;
+            }
+         }
+
+         /// Stop the thread, and drain what's left, while the sink still     
+         /// gets it                                                          
+         void Stop() {
+            _thread.request_stop();
+            if (_thread.joinable())
+               _thread.join();
+            Logger::Drain();
+            Logger::Detach(*_sink);
+         }
+      };
+
+      /// Magic at the start of binary log files, with a version              
+      constexpr char LogMagic[8] {'L', 'G', 'L', 'S', 'L', 'O', 'G', '1'};
+
+      /// Format ID of dictionary entries in binary log files                 
+      constexpr uint32_t LogDictionary = 0;
+   }
+
+
+   ///                                                                        
+   /// Log a message, with formatting deferred, e.g.                          
+   ///   log<"user {} failed login from {}">(user, address);                  
+   ///                                                                        
+   /// The format is checked at compile time, and turned into an argument     
+   /// layout with a stable ID. The call only copies that ID, a timestamp     
+   /// and the raw arguments into the calling thread's buffer - strings are   
+   /// copied, everything else takes 8 bytes. Formatting happens later, on    
+   /// the thread of a log_writer, or offline, when decoding the file of a    
+   /// log_recorder. Every open writer and recorder gets every message, and   
+   /// nothing is logged while none is open.                                  
+   ///                                                                        
+   template<literal_t FORMAT, class...A>
+      requires Inner::SidLiteral<decltype(FORMAT)>
+   void log(const A&...args) noexcept {
+      static_assert(Inner::LogPlaceholders(FORMAT) >= 0,
+         "Unmatched brace in log format, use {{ and }} for literal braces");
+      static_assert(Inner::LogPlaceholders(FORMAT) == sizeof...(A),
+         "Number of {} in log format doesn't match the number of arguments");
+
+      using Site = Inner::LogSite<FORMAT, Inner::LogKindOf<A>()...>;
+      static_cast<void>(&Site::Registered);
+
+      if (Inner::Logger::Enabled())
+         Inner::Logger::Write(Site::id, args...);
+   }
+
+
+   ///                                                                        
+   /// Formats log messages on a background thread, into a stream             
+   ///                                                                        
+   class log_writer {
+      ::std::ostream& _out;
+      ::std::string _line;
+      Inner::LogSink _sink {this,
+         [](void* owner, const Inner::LogHeader& h, const ::std::byte* payload) {
+            static_cast<log_writer*>(owner)->Record(h, payload);
+         },
+         [](void* owner) { static_cast<log_writer*>(owner)->_out.flush(); }
+      };
+      Inner::LogDrainThread _thread;
+
+      void Record(const Inner::LogHeader& h, const ::std::byte* payload) {
+         const auto format = Inner::Logger::FindFormat(h.format);
+         if (not format)
+            return;
+         _line.clear();
+         Inner::LogFormatRecord(_line, format->format, format->kinds,
+            format->count, h.time, payload, h.size);
+         _out.write(_line.data(), _line.size());
+      }
+
+   public:
+      explicit log_writer(::std::ostream& out,
+         ::std::chrono::milliseconds period = ::std::chrono::milliseconds {10})
+         : _out {out} {
+         _thread.Start(_sink, period);
+      }
+
+      ~log_writer() {
+         _thread.Stop();
+      }
+
+      log_writer(const log_writer&) = delete;
+      log_writer& operator = (const log_writer&) = delete;
+
+      /// Format everything logged so far, into this and every other sink     
+      ///   @return the number of messages                                    
+      size_t flush() {
+         return Inner::Logger::Drain();
+      }
+   };
+
+   ///                                                                        
+   /// Writes log messages into a binary file, unformatted, on a background   
+   /// thread - the cheapest way to log. Decode the file with decode_log      
+   ///                                                                        
+   /// The file is a magic, followed by records, each a header and its        
+   /// payload. Records with a zero format ID are dictionary entries, and     
+   /// describe a format the first time it's used: its ID, argument count,    
+   /// argument kinds and the format string itself.                           
+   ///                                                                        
+   class log_recorder {
+      ::std::ofstream _file;
+      ::std::unordered_map<uint32_t, bool> _known;
+      Inner::LogSink _sink {this,
+         [](void* owner, const Inner::LogHeader& h, const ::std::byte* payload) {
+            static_cast<log_recorder*>(owner)->Record(h, payload);
+         },
+         [](void* owner) { static_cast<log_recorder*>(owner)->_file.flush(); }
+      };
+      Inner::LogDrainThread _thread;
+
+      void Describe(const Inner::LogFormat& f) {
+         const Inner::LogHeader header {
+            Inner::LogDictionary,
+            static_cast<uint32_t>(8 + f.count + f.format.size()), 0
+         };
+         _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+         _file.write(reinterpret_cast<const char*>(&f.id), sizeof(f.id));
+         _file.write(reinterpret_cast<const char*>(&f.count), sizeof(f.count));
+         _file.write(reinterpret_cast<const char*>(f.kinds), f.count);
+         _file.write(f.format.data(), f.format.size());
+      }
+
+      void Record(const Inner::LogHeader& h, const ::std::byte* payload) {
+         auto& known = _known[h.format];
+         if (not known) {
+            const auto format = Inner::Logger::FindFormat(h.format);
+            if (not format)
+               return;
+            Describe(*format);
+            known = true;
+         }
+         _file.write(reinterpret_cast<const char*>(&h), sizeof(h));
+         _file.write(reinterpret_cast<const char*>(payload), h.size);
+      }
+
+   public:
+      explicit log_recorder(const ::std::filesystem::path& path,
+         ::std::chrono::milliseconds period = ::std::chrono::milliseconds {10})
+         : _file {path, ::std::ios::binary | ::std::ios::trunc} {
+         if (not _file)
+            throw ::std::runtime_error {"Can't open log file " + path.string()};
+         _file.write(Inner::LogMagic, sizeof(Inner::LogMagic));
+         _thread.Start(_sink, period);
+      }
+
+      ~log_recorder() {
+         _thread.Stop();
+      }
+
+      log_recorder(const log_recorder&) = delete;
+      log_recorder& operator = (const log_recorder&) = delete;
+
+      /// Write everything logged so far, into this and every other sink      
+      ///   @return the number of messages                                    
+      size_t flush() {
+         return Inner::Logger::Drain();
+      }
+   };
+
+   ///                                                                        
+   /// Decode a binary log, written by log_recorder, into text                
+   ///   @attention throws ::std::runtime_error if it isn't a log file        
+   ///   @return the number of messages                                       
+   ///                                                                        
+   inline size_t decode_log(::std::istream& in, ::std::ostream& out) {
+      char magic[sizeof(Inner::LogMagic)];
+      if (not in.read(magic, sizeof(magic))
+      or not ::std::equal(magic, magic + sizeof(magic), Inner::LogMagic))
+         throw ::std::runtime_error {"Not a log file, or an unsupported version"};
+
+      struct Format {
+         ::std::string format;
+         ::std::vector<Inner::LogKind> kinds;
+      };
+      ::std::unordered_map<uint32_t, Format> formats;
+      ::std::vector<::std::byte> payload;
+      ::std::string line;
+      size_t count = 0;
+
+      Inner::LogHeader header;
+      while (in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+         payload.resize(header.size);
+         if (not in.read(reinterpret_cast<char*>(payload.data()), header.size))
+            break;
+
+         if (header.format == Inner::LogDictionary) {
+            uint32_t id, args;
+            if (header.size < 8)
+               continue;
+            ::std::memcpy(&id, payload.data(), 4);
+            ::std::memcpy(&args, payload.data() + 4, 4);
+            if (8 + args > header.size)
+               continue;
+            auto& f = formats[id];
+            f.kinds.resize(args);
+            ::std::memcpy(f.kinds.data(), payload.data() + 8, args);
+            f.format.assign(reinterpret_cast<const char*>(payload.data()) + 8 + args, header.size - 8 - args);
+            continue;
+         }
+
+         const auto f = formats.find(header.format);
+         if (f == formats.end())
+            continue;
+
+         line.clear();
+         Inner::LogFormatRecord(line, f->second.format, f->second.kinds.data(),
+            static_cast<uint32_t>(f->second.kinds.size()), header.time, payload.data(), header.size);
+         out.write(line.data(), line.size());
+         ++count;
+      }
+      return count;
+   }
+}
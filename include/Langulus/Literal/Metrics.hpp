@@ -0,0 +1,316 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      /// Number of slots each metric is sharded into. Threads are spread     
+      /// over them round-robin, so up to this many threads never share one   
+      constexpr size_t MetricShards = 64;
+
+      /// Cache line size, so that shards never share one                     
+      constexpr size_t CacheLine = 64;
+
+      /// The shard of the calling thread                                     
+      inline size_t ThisShard() noexcept {
+         static constinit ::std::atomic<size_t> next = 0;
+         thread_local const size_t shard = next.fetch_add(1, ::std::memory_order_relaxed) % MetricShards;
+         return shard;
+      }
+
+      /// Turn a name into a valid Prometheus metric name, by replacing       
+      /// anything but letters, digits, underscores and colons with an        
+      /// underscore, e.g. "http.requests.total" -> "http_requests_total"     
+      template<literal_t NAME>
+      consteval auto PrometheusName() {
+         auto result = NAME;
+         for (size_t i = 0; i < result.size(); ++i) {
+            auto& c = result._data[i];
+            const bool valid = (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z')
+               or c == '_' or c == ':' or (i > 0 and c >= '0' and c <= '9');
+            if (not valid)
+               c = '_';
+         }
+         return result;
+      }
+
+      ///                                                                     
+      /// A metric, as seen by the exporter                                   
+      ///                                                                     
+      struct MetricNode {
+         ::std::string_view name;
+         void (*write)(::std::ostream&);
+         MetricNode* next;
+      };
+
+      ///                                                                     
+      /// All metrics used in the program, each registered once during static 
+      /// initialization - no lookups by name ever happen after that          
+      ///                                                                     
+      class Metrics {
+         static inline constinit ::std::atomic<MetricNode*> Head {nullptr};
+
+      public:
+         static bool Register(MetricNode* node) noexcept {
+            node->next = Head.load(::std::memory_order_relaxed);
+            while (not Head.compare_exchange_weak(node->next, node,
+               ::std::memory_order_release, ::std::memory_order_relaxed));
+            return true;
+         }
+
+         /// Metrics sorted by name, so output is the same on each scrape     
+         static ::std::vector<const MetricNode*> Sorted() {
+            ::std::vector<const MetricNode*> result;
+            for (auto node = Head.load(::std::memory_order_acquire); node; node = node->next)
+               result.push_back(node);
+            ::std::ranges::sort(result, {}, &MetricNode::name);
+            return result;
+         }
+      };
+
+      /// Write a number the shortest way that reads back the same            
+      template<class T>
+      void WriteNumber(::std::ostream& out, T value) {
+         char buffer[32];
+         const auto [end, error] = ::std::to_chars(buffer, buffer + sizeof(buffer), value);
+         out.write(buffer, end - buffer);
+      }
+
+      /// Write the bound of a histogram bucket, as Prometheus expects it     
+      inline void WriteBound(::std::ostream& out, double bound) {
+         if (bound == ::std::numeric_limits<double>::infinity())
+            out << "+Inf";
+         else
+            WriteNumber(out, bound);
+      }
+
+      template<class T>
+      concept MetricName = CT::LiteralString<T>
+          and ::std::same_as<typename T::value_type, char>;
+
+      template<class T>
+      struct alignas(CacheLine) Padded {
+         ::std::atomic<T> value {};
+      };
+   }
+
+
+   ///                                                                        
+   /// A monotonic counter, named by a literal                                
+   ///                                                                        
+   /// Each name is a distinct static object, so incrementing involves no     
+   /// lookups. Each thread increments its own cache-line-padded shard, and   
+   /// the shards are only summed up on scrape, e.g.                          
+   ///   counter<"http.requests.total">::inc();                               
+   ///                                                                        
+   template<literal_t NAME> requires Inner::MetricName<decltype(NAME)>
+   class counter {
+   public:
+      static constexpr auto literal = Inner::PrometheusName<NAME>();
+      static constexpr ::std::string_view name = literal;
+
+   private:
+      static inline constinit Inner::Padded<uint64_t> Shards[Inner::MetricShards] {};
+
+      static void Write(::std::ostream& out) {
+         out << "# TYPE " << name << " counter\n" << name << ' ';
+         Inner::WriteNumber(out, value());
+         out << '\n';
+      }
+
+      static inline constinit Inner::MetricNode Node {name, &Write, nullptr};
+      static inline const bool Registered = Inner::Metrics::Register(&Node);
+
+   public:
+      static void inc(uint64_t n = 1) noexcept {
+         static_cast<void>(&Registered);
+         Shards[Inner::ThisShard()].value.fetch_add(n, ::std::memory_order_relaxed);
+      }
+
+      static uint64_t value() noexcept {
+         uint64_t sum = 0;
+         for (auto& shard : Shards)
+            sum += shard.value.load(::std::memory_order_relaxed);
+         return sum;
+      }
+   };
+
+   ///                                                                        
+   /// A value that can go up and down, named by a literal                    
+   ///                                                                        
+   /// Usually set rather than incremented, so it's a single padded value,    
+   /// instead of sharded ones                                                
+   ///                                                                        
+   template<literal_t NAME> requires Inner::MetricName<decltype(NAME)>
+   class gauge {
+   public:
+      static constexpr auto literal = Inner::PrometheusName<NAME>();
+      static constexpr ::std::string_view name = literal;
+
+   private:
+      static inline constinit Inner::Padded<double> Value {};
+
+      static void Write(::std::ostream& out) {
+         out << "# TYPE " << name << " gauge\n" << name << ' ';
+         Inner::WriteNumber(out, value());
+         out << '\n';
+      }
+
+      static inline constinit Inner::MetricNode Node {name, &Write, nullptr};
+      static inline const bool Registered = Inner::Metrics::Register(&Node);
+
+   public:
+      static void set(double v) noexcept {
+         static_cast<void>(&Registered);
+         Value.value.store(v, ::std::memory_order_relaxed);
+      }
+
+      static void add(double v) noexcept {
+         static_cast<void>(&Registered);
+         Value.value.fetch_add(v, ::std::memory_order_relaxed);
+      }
+
+      static void inc() noexcept { add(1); }
+      static void dec() noexcept { add(-1); }
+
+      static double value() noexcept {
+         return Value.value.load(::std::memory_order_relaxed);
+      }
+   };
+
+   /// Prometheus' default buckets, for latencies in seconds                  
+   constexpr ::std::array<double, 11> DefaultBuckets {
+      .005, .01, .025, .05, .1, .25, .5, 1, 2.5, 5, 10
+   };
+
+   ///                                                                        
+   /// A distribution of observed values, named by a literal                  
+   ///                                                                        
+   /// Bucket bounds are a template argument too, so finding the bucket is    
+   /// a search through a constant array. Sharded like counters, e.g.         
+   ///   histogram<"http.latency.seconds">::observe(elapsed);                 
+   ///                                                                        
+   template<literal_t NAME, auto BOUNDS = DefaultBuckets>
+      requires Inner::MetricName<decltype(NAME)>
+   class histogram {
+   public:
+      static constexpr auto literal = Inner::PrometheusName<NAME>();
+      static constexpr ::std::string_view name = literal;
+      static constexpr auto bounds = BOUNDS;
+
+   private:
+      static_assert(::std::ranges::is_sorted(BOUNDS), "Bucket bounds must be sorted");
+      static constexpr size_t Buckets = BOUNDS.size() + 1;
+
+      struct alignas(Inner::CacheLine) Shard {
+         ::std::atomic<uint64_t> counts[Buckets] {};
+         ::std::atomic<double> sum {};
+      };
+
+      static inline constinit Shard Shards[Inner::MetricShards] {};
+
+      static void Write(::std::ostream& out) {
+         const auto counts = buckets();
+         double sum = 0;
+         for (auto& shard : Shards)
+            sum += shard.sum.load(::std::memory_order_relaxed);
+
+         out << "# TYPE " << name << " histogram\n";
+         uint64_t cumulative = 0;
+         for (size_t b = 0; b < Buckets; ++b) {
+            cumulative += counts[b];
+            out << name << "_bucket{le=\"";
+            Inner::WriteBound(out, b < BOUNDS.size() ? BOUNDS[b] : ::std::numeric_limits<double>::infinity());
+            out << "\"} ";
+            Inner::WriteNumber(out, cumulative);
+            out << '\n';
+         }
+
+         out << name << "_sum ";
+         Inner::WriteNumber(out, sum);
+         out << '\n' << name << "_count ";
+         Inner::WriteNumber(out, cumulative);
+         out << '\n';
+      }
+
+      static inline constinit Inner::MetricNode Node {name, &Write, nullptr};
+      static inline const bool Registered = Inner::Metrics::Register(&Node);
+
+   public:
+      static void observe(double v) noexcept {
+         static_cast<void>(&Registered);
+         const size_t b = ::std::ranges::lower_bound(BOUNDS, v) - BOUNDS.begin();
+         auto& shard = Shards[Inner::ThisShard()];
+         shard.counts[b].fetch_add(1, ::std::memory_order_relaxed);
+         shard.sum.fetch_add(v, ::std::memory_order_relaxed);
+      }
+
+      /// Number of observations in each bucket - not cumulative; the last    
+      /// one is for values above all bounds                                  
+      static ::std::array<uint64_t, Buckets> buckets() noexcept {
+         ::std::array<uint64_t, Buckets> result {};
+         for (auto& shard : Shards) {
+            for (size_t b = 0; b < Buckets; ++b)
+               result[b] += shard.counts[b].load(::std::memory_order_relaxed);
+         }
+         return result;
+      }
+
+      static uint64_t count() noexcept {
+         uint64_t result = 0;
+         for (auto c : buckets())
+            result += c;
+         return result;
+      }
+   };
+
+
+   ///                                                                        
+   /// Write all metrics used in the program, in the Prometheus text format   
+   ///                                                                        
+   inline void export_prometheus(::std::ostream& out = ::std::cout) {
+      for (auto node : Inner::Metrics::Sorted())
+         node->write(out);
+      out.flush();
+   }
+
+   ///                                                                        
+   /// Write all metrics to a file, e.g. for node_exporter's textfile         
+   /// collector. Written to a temporary file first, and then renamed, so     
+   /// that a scrape never sees a partially written file                      
+   ///   @return false if the file couldn't be written                        
+   ///                                                                        
+   inline bool export_prometheus(const ::std::filesystem::path& path) {
+      auto temporary = path;
+      temporary += ".tmp";
+      {
+         ::std::ofstream file {temporary, ::std::ios::binary | ::std::ios::trunc};
+         if (not file)
+            return false;
+         export_prometheus(file);
+         if (not file)
+            return false;
+      }
+
+      ::std::error_code error;
+      ::std::filesystem::rename(temporary, path, error);
+      return not error;
+   }
+}
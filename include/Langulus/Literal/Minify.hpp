@@ -0,0 +1,199 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Stripping comments and whitespace from literals at compile time, usually  
+/// ones embedded with langulus_embed_literal(), e.g.                         
+///   constexpr auto shader = minify<Embedded::shader, Lang::GLSL>();         
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+
+
+namespace Langulus
+{
+   /// The languages minify() knows the comments and strings of               
+   enum class Lang {
+      GLSL,       // Comments like C, preprocessor lines keep their newline
+      SQL,        // -- and /* */ comments, '' strings and "" identifiers
+      JSON        // "" strings with escapes, and comments like C, if any
+   };
+
+   namespace Inner
+   {
+      template<class T>
+      constexpr unsigned CodeUnit(T c) noexcept {
+         return static_cast<::std::make_unsigned_t<T>>(c);
+      }
+
+      constexpr bool IsSpace(unsigned c) noexcept {
+         return c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == '\v' or c == '\f';
+      }
+
+      /// Part of an identifier, a keyword or a number - anything past ASCII  
+      /// counts, so UTF-8 identifiers stay whole. Quotes count too, so       
+      /// prefixed strings, like SQL's E'...', keep their meaning             
+      constexpr bool IsWord(unsigned c) noexcept {
+         return (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z')
+             or (c >= '0' and c <= '9') or c == '_' or c == '$' or c >= 0x80
+             or c == '\'' or c == '"';
+      }
+
+      /// A number that starts with a dot, like .5 - it would join a word     
+      /// before it, turning 'return .5' into 'return.5'                      
+      constexpr bool IsFraction(unsigned c, unsigned next) noexcept {
+         return c == '.' and next >= '0' and next <= '9';
+      }
+
+      /// Two of these in a row might make a different operator, or start a   
+      /// comment, like '- -' and '/ *' do                                    
+      constexpr bool IsOperator(unsigned c) noexcept {
+         return ::std::string_view {"+-*/%<>=!&|^~?:.#"}.find(static_cast<char>(c)) != ::std::string_view::npos;
+      }
+
+      ///                                                                     
+      /// Strip comments, and collapse whitespace of the given language       
+      ///                                                                     
+      /// Whitespace between tokens becomes a single space, and only where    
+      /// dropping it could join two tokens into one. Strings are copied as   
+      /// they are. Whitespace inside preprocessor lines is kept as a single  
+      /// space, because '#define A (x)' and '#define A(x)' differ, and each  
+      /// preprocessor line still ends with a newline                         
+      ///   @param in - the text to minify                                    
+      ///   @param out - where to write the result, or nullptr to only count  
+      ///   @return the number of characters in the result                    
+      ///                                                                     
+      template<Lang LANG, class T>
+      constexpr size_t Minify(::std::basic_string_view<T> in, T* out) noexcept {
+         const size_t n = in.size();
+         const auto at = [&](size_t i) -> unsigned {
+            return i < n ? CodeUnit(in[i]) : 0u;
+         };
+
+         size_t size = 0;
+         unsigned last = 0;
+         const auto put = [&](T c) {
+            if (out)
+               out[size] = c;
+            ++size;
+            last = CodeUnit(c);
+         };
+
+         bool space = false;        // skipped whitespace or a comment
+         bool directive = false;    // inside a preprocessor line
+         bool lineStart = true;     // nothing but whitespace on the line
+
+         size_t i = 0;
+         while (i < n) {
+            const auto c = at(i);
+
+            // Comments are whitespace - a line comment leaves its newline
+            const bool lineComment = LANG == Lang::SQL
+               ? c == '-' and at(i + 1) == '-'
+               : c == '/' and at(i + 1) == '/';
+            if (lineComment) {
+               while (i < n and at(i) != '\n')
+                  ++i;
+               space = true;
+               continue;
+            }
+
+            if (c == '/' and at(i + 1) == '*') {
+               i += 2;
+               while (i < n and not (at(i) == '*' and at(i + 1) == '/'))
+                  ++i;
+               i = i < n ? i + 2 : n;
+               space = true;
+               continue;
+            }
+
+            // Line continuations only matter in preprocessor lines     
+            if (directive and c == '\\') {
+               const auto next = at(i + 1) == '\r' ? i + 2 : i + 1;
+               if (at(next) == '\n') {
+                  put(T {'\\'});
+                  put(T {'\n'});
+                  i = next + 1;
+                  space = false;
+                  continue;
+               }
+            }
+
+            if (c == '\n') {
+               if (directive) {
+                  put(T {'\n'});
+                  directive = false;
+                  space = false;
+               }
+               else space = true;
+               lineStart = true;
+               ++i;
+               continue;
+            }
+
+            if (IsSpace(c)) {
+               space = true;
+               ++i;
+               continue;
+            }
+
+            // Preprocessor lines start on a line of their own          
+            if (LANG == Lang::GLSL and c == '#' and lineStart) {
+               if (size and last != '\n')
+                  put(T {'\n'});
+               directive = true;
+               space = false;
+            }
+            else if (space and size and last != '\n') {
+               if (directive or (IsWord(last) and (IsWord(c) or IsFraction(c, at(i + 1))))
+               or (IsOperator(last) and IsOperator(c)))
+                  put(T {' '});
+            }
+
+            space = false;
+            lineStart = false;
+
+            // Strings and quoted identifiers are copied as they are    
+            const bool quote = (c == '"' and LANG != Lang::GLSL) or (c == '\'' and LANG == Lang::SQL);
+            if (quote) {
+               put(in[i++]);
+               while (i < n and at(i) != c) {
+                  if (LANG == Lang::JSON and at(i) == '\\' and i + 1 < n)
+                     put(in[i++]);
+                  put(in[i++]);
+               }
+               if (i < n)
+                  put(in[i++]);
+               continue;
+            }
+
+            put(in[i++]);
+         }
+
+         return size;
+      }
+   }
+
+   ///                                                                        
+   /// Strip comments, and collapse whitespace of a literal at compile time   
+   ///                                                                        
+   /// The result has the smallest capacity that fits it, so only the         
+   /// minified text ends up in the binary, e.g.                              
+   ///   constexpr auto query = minify<Embedded::query, Lang::SQL>();         
+   ///   @tparam L - the literal to minify                                    
+   ///   @tparam LANG - the language of the literal                           
+   ///   @return the minified literal                                         
+   ///                                                                        
+   template<literal_t L, Lang LANG> requires CT::LiteralString<decltype(L)>
+   consteval auto minify() noexcept {
+      using T = typename decltype(L)::value_type;
+      constexpr ::std::basic_string_view<T> in = L;
+      constexpr auto size = Inner::Minify<LANG>(in, static_cast<T*>(nullptr));
+      literal_t<T, ::std::bit_ceil(size + 1)> result;
+      Inner::Minify<LANG>(in, result.data());
+      return result;
+   }
+}
@@ -0,0 +1,362 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Pack.hpp"
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      template<class T>
+      concept FieldName = CT::LiteralString<T>
+          and ::std::same_as<typename T::value_type, char>;
+   }
+
+   /// A named field of a named_tuple or named_columns                        
+   template<literal_t NAME, class T> requires Inner::FieldName<decltype(NAME)>
+   struct field {
+      static constexpr auto name = NAME;
+      using type = T;
+   };
+
+   namespace Inner
+   {
+      /// Storage of the field at index I - fields are distinct bases, told   
+      /// apart by their index, and picked by deducing it                     
+      template<size_t I, class T>
+      struct FieldSlot {
+         T value {};
+
+         constexpr bool operator == (const FieldSlot&) const = default;
+      };
+
+      template<size_t I, class T>
+      constexpr T& SlotOf(FieldSlot<I, T>& slot) noexcept {
+         return slot.value;
+      }
+
+      template<size_t I, class T>
+      constexpr const T& SlotOf(const FieldSlot<I, T>& slot) noexcept {
+         return slot.value;
+      }
+
+      template<class S, class...F>
+      struct NamedTupleBase;
+
+      template<size_t...I, class...F>
+      struct NamedTupleBase<::std::index_sequence<I...>, F...>
+         : FieldSlot<I, typename F::type>... {
+         constexpr NamedTupleBase() = default;
+
+         template<class...A>
+         constexpr NamedTupleBase(::std::in_place_t, A&&...values)
+            : FieldSlot<I, typename F::type> {::std::forward<A>(values)}... {}
+
+         constexpr bool operator == (const NamedTupleBase&) const = default;
+      };
+   }
+
+
+   ///                                                                        
+   /// A tuple with fields accessed by name, e.g.                             
+   ///   named_tuple<field<"x", float>, field<"name", literal_t<char, 16>>> t;
+   ///   get<"x">(t) = 1;                                                     
+   /// Names are resolved at compile time, through a literal_pack of them,    
+   /// and the fields are laid out in order, just like in a plain struct      
+   ///                                                                        
+   template<class...F>
+   class named_tuple : public Inner::NamedTupleBase<::std::index_sequence_for<F...>, F...> {
+      using Base = Inner::NamedTupleBase<::std::index_sequence_for<F...>, F...>;
+
+   public:
+      using index = literal_pack<F::name...>;
+      static_assert(index::unique, "Field names of a named_tuple must be unique");
+
+      static constexpr size_t size = sizeof...(F);
+
+      /// Index of a field, or npos if there's no field with that name        
+      template<literal_t NAME>
+      static constexpr size_t index_of = index::template index_of<NAME>;
+
+      template<literal_t NAME>
+      static constexpr bool contains = index_of<NAME> != index::npos;
+
+      template<size_t I>
+      using type_at = ::std::remove_cvref_t<decltype(Inner::SlotOf<I>(::std::declval<Base&>()))>;
+
+      constexpr named_tuple() = default;
+
+      constexpr named_tuple(const typename F::type&...values) requires (sizeof...(F) > 0)
+         : Base {::std::in_place, values...} {}
+
+      constexpr bool operator == (const named_tuple&) const = default;
+   };
+
+   /// Access a field of a named_tuple by name                                
+   template<literal_t NAME, class...F> requires Inner::FieldName<decltype(NAME)>
+   constexpr auto& get(named_tuple<F...>& t) noexcept {
+      constexpr auto i = named_tuple<F...>::template index_of<NAME>;
+      static_assert(i != named_tuple<F...>::index::npos, "No field with this name");
+      return Inner::SlotOf<i>(t);
+   }
+
+   template<literal_t NAME, class...F> requires Inner::FieldName<decltype(NAME)>
+   constexpr const auto& get(const named_tuple<F...>& t) noexcept {
+      constexpr auto i = named_tuple<F...>::template index_of<NAME>;
+      static_assert(i != named_tuple<F...>::index::npos, "No field with this name");
+      return Inner::SlotOf<i>(t);
+   }
+
+   template<literal_t NAME, class...F> requires Inner::FieldName<decltype(NAME)>
+   constexpr auto&& get(named_tuple<F...>&& t) noexcept {
+      return ::std::move(get<NAME>(t));
+   }
+
+   /// Access a field by index, for structured bindings                       
+   template<size_t I, class...F>
+   constexpr auto& get(named_tuple<F...>& t) noexcept {
+      return Inner::SlotOf<I>(t);
+   }
+
+   template<size_t I, class...F>
+   constexpr const auto& get(const named_tuple<F...>& t) noexcept {
+      return Inner::SlotOf<I>(t);
+   }
+
+   template<size_t I, class...F>
+   constexpr auto&& get(named_tuple<F...>&& t) noexcept {
+      return ::std::move(Inner::SlotOf<I>(t));
+   }
+
+
+   ///                                                                        
+   /// Named fields stored as columns - each field in its own contiguous      
+   /// array, aligned for SIMD, e.g.                                          
+   ///   named_columns<field<"x", float>, field<"y", float>> points;          
+   ///   points.push_back(1, 2);                                              
+   ///   for (float& x : get<"x">(points)) ...                                
+   /// Rows are named_tuples with the same fields                             
+   ///                                                                        
+   template<class...F>
+   class named_columns {
+   public:
+      using row_type = named_tuple<F...>;
+      using size_type = size_t;
+      using index = typename row_type::index;
+
+      /// Alignment of each column, enough for any vector instruction set     
+      static constexpr size_t alignment = 64;
+
+   private:
+      static_assert((::std::is_nothrow_move_constructible_v<typename F::type> and ...),
+         "Column types must be nothrow move constructible");
+
+      template<size_t I>
+      using T = typename row_type::template type_at<I>;
+
+      /// Pointers to the columns, in the same flat layout as a row           
+      using Columns = Inner::NamedTupleBase<::std::index_sequence_for<F...>,
+         field<F::name, typename F::type*>...>;
+
+      Columns _columns {};
+      size_type _size = 0;
+      size_type _capacity = 0;
+
+      template<size_t I>
+      static T<I>* Allocate(size_type count) {
+         return static_cast<T<I>*>(::operator new(count * sizeof(T<I>),
+            ::std::align_val_t {::std::max(alignment, alignof(T<I>))}));
+      }
+
+      template<size_t I>
+      static void Deallocate(T<I>* data) noexcept {
+         ::operator delete(data, ::std::align_val_t {::std::max(alignment, alignof(T<I>))});
+      }
+
+      template<size_t...I>
+      void Grow(size_type capacity, ::std::index_sequence<I...>) {
+         Columns fresh {};
+         try { ((Inner::SlotOf<I>(fresh) = Allocate<I>(capacity)), ...); }
+         catch (...) {
+            ((Inner::SlotOf<I>(fresh) ? Deallocate<I>(Inner::SlotOf<I>(fresh)) : void()), ...);
+            throw;
+         }
+
+         (([&] {
+            auto& from = Inner::SlotOf<I>(_columns);
+            if (from) {
+               ::std::uninitialized_move_n(from, _size, Inner::SlotOf<I>(fresh));
+               ::std::destroy_n(from, _size);
+               Deallocate<I>(from);
+            }
+         }()), ...);
+
+         _columns = fresh;
+         _capacity = capacity;
+      }
+
+      template<size_t...I>
+      void Release(::std::index_sequence<I...>) noexcept {
+         (([&] {
+            if (auto& data = Inner::SlotOf<I>(_columns)) {
+               ::std::destroy_n(data, _size);
+               Deallocate<I>(data);
+               data = nullptr;
+            }
+         }()), ...);
+      }
+
+      /// Construct the element past the end of each column - if one throws, 
+      /// the ones constructed before it are destroyed                        
+      template<size_t...I, class...A>
+      void Construct(::std::index_sequence<I...>, A&&...values) {
+         size_t constructed = 0;
+         try {
+            ((::std::construct_at(Inner::SlotOf<I>(_columns) + _size, ::std::forward<A>(values)), ++constructed), ...);
+         }
+         catch (...) {
+            ((I < constructed ? ::std::destroy_at(Inner::SlotOf<I>(_columns) + _size) : void()), ...);
+            throw;
+         }
+         ++_size;
+      }
+
+      template<size_t...I, class...A>
+      void Append(::std::index_sequence<I...> fields, A&&...values) {
+         if (_size == _capacity) {
+            // Values might refer into the columns, so copy them before    
+            // growing frees those                                         
+            row_type row {::std::forward<A>(values)...};
+            reserve(_capacity ? _capacity * 2 : 16);
+            Construct(fields, ::std::move(get<I>(row))...);
+         }
+         else Construct(fields, ::std::forward<A>(values)...);
+      }
+
+      template<size_t...I>
+      row_type Row(size_type i, ::std::index_sequence<I...>) const {
+         return row_type {Inner::SlotOf<I>(_columns)[i]...};
+      }
+
+   public:
+      named_columns() = default;
+
+      named_columns(const named_columns& other) {
+         reserve(other._size);
+         for (size_type i = 0; i < other._size; ++i)
+            push_back(other[i]);
+      }
+
+      named_columns(named_columns&& other) noexcept
+         : _columns {::std::exchange(other._columns, {})}
+         , _size {::std::exchange(other._size, 0)}
+         , _capacity {::std::exchange(other._capacity, 0)} {}
+
+      named_columns& operator = (named_columns other) noexcept {
+         swap(other);
+         return *this;
+      }
+
+      ~named_columns() {
+         Release(::std::index_sequence_for<F...> {});
+      }
+
+      void swap(named_columns& other) noexcept {
+         ::std::swap(_columns, other._columns);
+         ::std::swap(_size, other._size);
+         ::std::swap(_capacity, other._capacity);
+      }
+
+      size_type size() const noexcept { return _size; }
+      size_type capacity() const noexcept { return _capacity; }
+      bool empty() const noexcept { return _size == 0; }
+
+      void reserve(size_type capacity) {
+         if (capacity > _capacity)
+            Grow(capacity, ::std::index_sequence_for<F...> {});
+      }
+
+      void clear() noexcept {
+         [&]<size_t...I>(::std::index_sequence<I...>) {
+            (::std::destroy_n(Inner::SlotOf<I>(_columns), _size), ...);
+         }(::std::index_sequence_for<F...> {});
+         _size = 0;
+      }
+
+      /// Add a row, given a value for each field                             
+      void push_back(const typename F::type&...values) {
+         Append(::std::index_sequence_for<F...> {}, values...);
+      }
+
+      void push_back(const row_type& row) {
+         [&]<size_t...I>(::std::index_sequence<I...>) {
+            Append(::std::index_sequence_for<F...> {}, get<I>(row)...);
+         }(::std::index_sequence_for<F...> {});
+      }
+
+      /// Copy of a row                                                       
+      row_type operator [] (size_type i) const {
+         return Row(i, ::std::index_sequence_for<F...> {});
+      }
+
+      /// A field of a row                                                    
+      template<literal_t NAME> requires Inner::FieldName<decltype(NAME)>
+      auto& at(size_type i) noexcept {
+         return column<NAME>()[i];
+      }
+
+      template<literal_t NAME> requires Inner::FieldName<decltype(NAME)>
+      const auto& at(size_type i) const noexcept {
+         return column<NAME>()[i];
+      }
+
+      /// A whole column                                                      
+      template<literal_t NAME> requires Inner::FieldName<decltype(NAME)>
+      auto column() noexcept {
+         constexpr auto i = row_type::template index_of<NAME>;
+         static_assert(i != index::npos, "No field with this name");
+         return ::std::span<T<i>> {Inner::SlotOf<i>(_columns), _size};
+      }
+
+      template<literal_t NAME> requires Inner::FieldName<decltype(NAME)>
+      auto column() const noexcept {
+         constexpr auto i = row_type::template index_of<NAME>;
+         static_assert(i != index::npos, "No field with this name");
+         return ::std::span<const T<i>> {Inner::SlotOf<i>(_columns), _size};
+      }
+   };
+
+   /// A whole column of named_columns, by name                               
+   template<literal_t NAME, class...F> requires Inner::FieldName<decltype(NAME)>
+   auto get(named_columns<F...>& columns) noexcept {
+      return columns.template column<NAME>();
+   }
+
+   template<literal_t NAME, class...F> requires Inner::FieldName<decltype(NAME)>
+   auto get(const named_columns<F...>& columns) noexcept {
+      return columns.template column<NAME>();
+   }
+}
+
+namespace std
+{
+   /// Structured bindings for named_tuple                                    
+   template<class...F>
+   struct tuple_size<::Langulus::named_tuple<F...>>
+      : integral_constant<size_t, sizeof...(F)> {};
+
+   template<size_t I, class...F>
+   struct tuple_element<I, ::Langulus::named_tuple<F...>> {
+      using type = typename ::Langulus::named_tuple<F...>::template type_at<I>;
+   };
+}
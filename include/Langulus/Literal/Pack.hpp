@@ -0,0 +1,206 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Core.hpp"
+#include "Hash.hpp"
+#include <algorithm>
+#include <utility>
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      /// Character type of a pack of string literals, char if it's empty     
+      template<literal_t...V>
+      struct PackChar { using type = char; };
+
+      template<literal_t FIRST, literal_t...V>
+      struct PackChar<FIRST, V...> { using type = typename decltype(FIRST)::value_type; };
+
+      /// Checked over an array, because folding a few thousand literals      
+      /// exceeds the expression nesting limit of some compilers              
+      template<literal_t...V>
+      consteval bool PackCheck() {
+         using C = typename PackChar<V...>::type;
+         constexpr bool checks[] {true,
+            (CT::LiteralString<decltype(V)>
+               and ::std::same_as<typename decltype(V)::value_type, C>)...
+         };
+         for (auto check : checks) {
+            if (not check)
+               return false;
+         }
+         return true;
+      }
+
+      template<literal_t...V>
+      concept PackOfStrings = PackCheck<V...>();
+
+      /// Element I of a pack is a distinct base, picked by deducing it,      
+      /// instead of by peeling off elements one instantiation at a time      
+      template<size_t I, auto V>
+      struct PackLeaf {};
+
+      template<size_t I, auto V>
+      consteval auto PackAt(const PackLeaf<I, V>*) noexcept {
+         return V;
+      }
+
+      template<class S, auto...V>
+      struct PackLeaves;
+
+      template<size_t...I, auto...V>
+      struct PackLeaves<::std::index_sequence<I...>, V...> : PackLeaf<I, V>... {};
+   }
+
+
+   ///                                                                        
+   /// A pack of string literals, searched at compile time, e.g.              
+   ///   literal_pack<"a", "b", "x">::index_of<"x"> == 2                      
+   /// The literals are viewed as one array, and every query is a single      
+   /// consteval pass over it - never a recursive instantiation per element,  
+   /// so compile time stays flat with thousands of literals. Lookups go      
+   /// through an open-addressing table of the literals' hashes, built once   
+   /// per pack, on first use                                                 
+   ///                                                                        
+   template<literal_t...V> requires Inner::PackOfStrings<V...>
+   struct literal_pack {
+      using value_type = typename Inner::PackChar<V...>::type;
+      using view_type = ::std::basic_string_view<value_type>;
+
+      static constexpr size_t size = sizeof...(V);
+      static constexpr size_t npos = static_cast<size_t>(-1);
+
+      static constexpr ::std::array<view_type, size> views {
+         static_cast<view_type>(V)...
+      };
+
+   private:
+      static constexpr size_t Slots = size ? ::std::bit_ceil(size * 2) : 1;
+
+      /// Index + 1 of the literal in each slot, zero for empty ones          
+      static consteval ::std::array<uint32_t, Slots> Build() {
+         ::std::array<uint32_t, Slots> table {};
+         for (size_t i = 0; i < size; ++i) {
+            auto slot = Inner::HashView(views[i]) & (Slots - 1);
+            while (table[slot])
+               slot = (slot + 1) & (Slots - 1);
+            table[slot] = static_cast<uint32_t>(i + 1);
+         }
+         return table;
+      }
+
+      static constexpr ::std::array<uint32_t, Slots> table = Build();
+
+      static consteval bool Unique() {
+         for (size_t i = 0; i < size; ++i) {
+            if (find(views[i]) != i)
+               return false;
+         }
+         return true;
+      }
+
+      /// Indices of the literals, in lexicographic order - equal literals    
+      /// stay in the order they were given                                   
+      static consteval ::std::array<size_t, size> Order() {
+         ::std::array<size_t, size> order {};
+         for (size_t i = 0; i < size; ++i)
+            order[i] = i;
+         ::std::sort(order.begin(), order.end(), [](size_t a, size_t b) {
+            const auto c = views[a].compare(views[b]);
+            return c < 0 or (c == 0 and a < b);
+         });
+         return order;
+      }
+
+   public:
+      /// Index of the first occurence of a string, or npos                   
+      static consteval size_t find(view_type name) {
+         for (auto slot = Inner::HashView(name) & (Slots - 1); table[slot]; slot = (slot + 1) & (Slots - 1)) {
+            if (views[table[slot] - 1] == name)
+               return table[slot] - 1;
+         }
+         return npos;
+      }
+
+      /// Literal at an index, with its original type                         
+      template<size_t I> requires (I < size)
+      static constexpr auto at = Inner::PackAt<I>(
+         static_cast<const Inner::PackLeaves<::std::index_sequence_for<decltype(V)...>, V...>*>(nullptr));
+
+      template<literal_t NAME> requires CT::LiteralString<decltype(NAME)>
+      static constexpr size_t index_of = find(static_cast<view_type>(NAME));
+
+      template<literal_t NAME> requires CT::LiteralString<decltype(NAME)>
+      static constexpr bool contains = index_of<NAME> != npos;
+
+      /// True if no literal is repeated                                      
+      static constexpr bool unique = Unique();
+
+      /// Permutation that sorts the pack, see pack_sort                      
+      static constexpr ::std::array<size_t, size> order = Order();
+   };
+
+   namespace Inner
+   {
+      template<class P, class S = ::std::make_index_sequence<P::size>>
+      struct PackSorted;
+
+      template<class P, size_t...I>
+      struct PackSorted<P, ::std::index_sequence<I...>> {
+         using type = literal_pack<P::template at<P::order[I]>...>;
+      };
+
+      /// Distinct literals of a pack, sorted, for comparing them as sets     
+      template<class P>
+      consteval auto PackDistinct() {
+         ::std::array<typename P::view_type, P::size> result {};
+         size_t count = 0;
+         for (auto i : P::order) {
+            if (not count or result[count - 1] != P::views[i])
+               result[count++] = P::views[i];
+         }
+         return ::std::pair {result, count};
+      }
+
+      template<class A, class B>
+      consteval bool PackSetEqual() {
+         constexpr auto a = PackDistinct<A>();
+         constexpr auto b = PackDistinct<B>();
+         if (a.second != b.second)
+            return false;
+         for (size_t i = 0; i < a.second; ++i) {
+            if (a.first[i] != b.first[i])
+               return false;
+         }
+         return true;
+      }
+   }
+
+   /// Index of the first NAME among V, or literal_pack<V...>::npos           
+   template<literal_t NAME, literal_t...V>
+   constexpr size_t pack_index_of = literal_pack<V...>::template index_of<NAME>;
+
+   /// Check if NAME is among V                                               
+   template<literal_t NAME, literal_t...V>
+   constexpr bool pack_contains = literal_pack<V...>::template contains<NAME>;
+
+   /// Check if none of V are repeated                                        
+   template<literal_t...V>
+   constexpr bool pack_unique = literal_pack<V...>::unique;
+
+   /// A literal_pack with V in lexicographic order                           
+   template<literal_t...V>
+   using pack_sort = typename Inner::PackSorted<literal_pack<V...>>::type;
+
+   /// Check if two literal_packs contain the same literals, regardless of    
+   /// their order and repetitions                                            
+   template<class A, class B>
+   constexpr bool pack_set_equal = Inner::PackSetEqual<A, B>();
+}
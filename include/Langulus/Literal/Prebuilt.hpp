@@ -0,0 +1,28 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// The literal_t specializations that LangulusLiteralPrebuilt compiles once  
+/// for everyone. When linking it, LANGULUS_OPTION_PREBUILT is defined, and   
+/// these are declared extern template, so that user TUs don't generate code  
+/// for them, and there's only one copy of each in the final binary. The      
+/// list itself is in Prebuilt.inl                                            
+///                                                                           
+#pragma once
+#include "Compare.hpp"
+#include "Concat.hpp"
+#include "Hash.hpp"
+
+#ifdef LANGULUS_OPTION_PREBUILT
+   #define lgls_prebuilt_literal(T, N) \
+      extern template struct ::Langulus::literal_t<T, N>;
+   #define lgls_prebuilt_type(T) \
+      namespace Langulus::Inner { \
+         extern template struct Text<T>; \
+         extern template uint64_t HashView<T>(::std::basic_string_view<T>) noexcept; \
+      }
+   #include "Prebuilt.inl"
+#endif
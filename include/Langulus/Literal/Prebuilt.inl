@@ -0,0 +1,42 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// The list of specializations LangulusLiteralPrebuilt compiles. Not a       
+/// header - define lgls_prebuilt_literal(T, N) and/or lgls_prebuilt_type(T)  
+/// before including it, and they are invoked for every prebuilt character    
+/// type T and capacity N, and then undefined. Capacities are the powers of   
+/// two CTAD produces for strings of up to 255 characters, the empty string   
+/// being the only one left out                                               
+///                                                                           
+#ifdef lgls_prebuilt_literal
+   #define lgls_prebuilt_chars(N) \
+      lgls_prebuilt_literal(char, N)     lgls_prebuilt_literal(wchar_t, N) \
+      lgls_prebuilt_literal(char8_t, N)  lgls_prebuilt_literal(char16_t, N) \
+      lgls_prebuilt_literal(char32_t, N)
+
+   lgls_prebuilt_chars(2)
+   lgls_prebuilt_chars(4)
+   lgls_prebuilt_chars(8)
+   lgls_prebuilt_chars(16)
+   lgls_prebuilt_chars(32)
+   lgls_prebuilt_chars(64)
+   lgls_prebuilt_chars(128)
+   lgls_prebuilt_chars(256)
+
+   #undef lgls_prebuilt_chars
+   #undef lgls_prebuilt_literal
+#endif
+
+#ifdef lgls_prebuilt_type
+   lgls_prebuilt_type(char)
+   lgls_prebuilt_type(wchar_t)
+   lgls_prebuilt_type(char8_t)
+   lgls_prebuilt_type(char16_t)
+   lgls_prebuilt_type(char32_t)
+
+   #undef lgls_prebuilt_type
+#endif
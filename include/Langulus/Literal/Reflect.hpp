@@ -0,0 +1,284 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#if defined(_MSC_VER) and not defined(__clang__)
+   #define lgls_function_name() __FUNCSIG__
+#else
+   #define lgls_function_name() __PRETTY_FUNCTION__
+#endif
+
+
+namespace Langulus
+{
+   ///                                                                        
+   /// Range of values scanned for enumerators by enum_name(value),           
+   /// enum_values and enum_from_string. Specialize it for enums with         
+   /// values outside of it, keeping it as narrow as possible - each value    
+   /// in the range is an instantiation                                       
+   ///                                                                        
+   template<class E> requires ::std::is_enum_v<E>
+   struct enum_range {
+      using U = ::std::underlying_type_t<E>;
+      static constexpr int64_t min = ::std::max<int64_t>(
+         ::std::is_signed_v<U> ? -128 : 0, ::std::numeric_limits<U>::min());
+      static constexpr int64_t max = ::std::min<int64_t>(
+         ::std::is_signed_v<U> ? 127 : 255, ::std::numeric_limits<U>::max());
+   };
+
+   namespace Inner
+   {
+      /// The compiler's signature of this function, which contains T         
+      template<class T>
+      consteval ::std::string_view TypeSignature() {
+         return lgls_function_name();
+      }
+
+      /// The compiler's signature of this function, which contains V         
+      template<auto V>
+      consteval ::std::string_view ValueSignature() {
+         return lgls_function_name();
+      }
+
+      /// Where a name is in a signature - found once, through a probe with   
+      /// a known name, since the text around it is the same for all          
+      struct NameBounds {
+         size_t prefix;
+         size_t suffix;
+
+         consteval NameBounds(::std::string_view probe, ::std::string_view name)
+            : prefix {probe.find(name)}
+            , suffix {probe.size() - probe.find(name) - name.size()} {}
+
+         consteval ::std::string_view operator() (::std::string_view signature) const {
+            return signature.substr(prefix, signature.size() - prefix - suffix);
+         }
+      };
+
+      constexpr NameBounds TypeBounds {TypeSignature<double>(), "double"};
+      constexpr NameBounds ValueBounds {ValueSignature<42>(), "42"};
+
+      template<class T>
+      consteval ::std::string_view TypeName() {
+         auto name = TypeBounds(TypeSignature<T>());
+         // MSVC puts the kind of the type in front of the name         
+         for (::std::string_view kind : {"class ", "struct ", "enum ", "union "}) {
+            if (name.starts_with(kind))
+               name.remove_prefix(kind.size());
+         }
+         return name;
+      }
+
+      /// Name of an enumerator without its scope, or an empty view for a     
+      /// value that isn't one - those are printed as a cast or a number      
+      template<auto V>
+      consteval ::std::string_view EnumName() {
+         auto name = ValueBounds(ValueSignature<V>());
+         if (name.empty() or name[0] == '(' or name[0] == '-'
+         or (name[0] >= '0' and name[0] <= '9'))
+            return {};
+
+         const auto scope = name.rfind(':');
+         if (scope != name.npos)
+            name.remove_prefix(scope + 1);
+         return name;
+      }
+
+      /// Copy a name into a literal, with the capacity CTAD would give a     
+      /// string literal of the same text                                     
+      template<size_t SIZE>
+      consteval auto NameLiteral(::std::string_view name) {
+         literal_t<char, ::std::bit_ceil(SIZE + 1)> result;
+         for (size_t i = 0; i < SIZE; ++i)
+            result._data[i] = name[i];
+         return result;
+      }
+   }
+
+
+   ///                                                                        
+   /// Name of a type, as the compiler spells it, e.g.                        
+   ///   type_name<Langulus::sid64_t>() == "Langulus::sid64_t"                
+   /// Spelling differs between compilers, so it's fine for reflection and    
+   /// diagnostics, but not for persisting                                    
+   ///                                                                        
+   template<class T>
+   consteval auto type_name() {
+      constexpr auto name = Inner::TypeName<T>();
+      return Inner::NameLiteral<name.size()>(name);
+   }
+
+   /// Name of an enumerator without its scope, e.g. enum_name<Color::Red>()  
+   /// is "Red", or an empty literal if the value isn't an enumerator         
+   template<auto V> requires ::std::is_enum_v<decltype(V)>
+   consteval auto enum_name() {
+      constexpr auto name = Inner::EnumName<V>();
+      return Inner::NameLiteral<name.size()>(name);
+   }
+
+   template<class E, E V> requires ::std::is_enum_v<E>
+   consteval auto enum_name() {
+      return enum_name<V>();
+   }
+
+   /// The names in static storage. Names can also be interned without any    
+   /// copies or parsing, as intern<type_name<T>()>() points straight at its  
+   /// template parameter object                                              
+   template<class T>
+   constexpr auto type_name_v = type_name<T>();
+
+   template<auto V> requires ::std::is_enum_v<decltype(V)>
+   constexpr auto enum_name_v = enum_name<V>();
+
+   namespace Inner
+   {
+      template<class E>
+      constexpr size_t EnumRangeSize = static_cast<size_t>(enum_range<E>::max - enum_range<E>::min + 1);
+
+      template<class E, size_t...I>
+      consteval auto EnumScan(::std::index_sequence<I...>) {
+         constexpr bool valid[] {
+            not EnumName<static_cast<E>(enum_range<E>::min + static_cast<int64_t>(I))>().empty()...
+         };
+         constexpr size_t count = (size_t {0} + ... + valid[I]);
+
+         ::std::array<E, count> result {};
+         size_t n = 0;
+         for (size_t i = 0; i < sizeof...(I); ++i) {
+            if (valid[i])
+               result[n++] = static_cast<E>(enum_range<E>::min + static_cast<int64_t>(i));
+         }
+         return result;
+      }
+
+      template<class E, auto VALUES, size_t...I>
+      consteval auto EnumNames(::std::index_sequence<I...>) {
+         return ::std::array<::std::string_view, sizeof...(I)> {
+            static_cast<::std::string_view>(enum_name_v<VALUES[I]>)...
+         };
+      }
+
+      /// Picks a slot for a hashed name, given the displacement of its       
+      /// bucket                                                              
+      constexpr size_t PerfectSlot(uint64_t hash, uint32_t displacement, size_t mask) noexcept {
+         return static_cast<size_t>(HashFinal(hash + displacement * HashSeed)) & mask;
+      }
+
+      ///                                                                     
+      /// A perfect hash of a set of names, built with hash-and-displace:     
+      /// names are spread into buckets by their hash, and each bucket,       
+      /// largest first, gets the first displacement that puts its names      
+      /// into free slots. A lookup is then a hash, two loads and a single    
+      /// string comparison                                                   
+      ///                                                                     
+      template<size_t N>
+      struct PerfectHash {
+         static constexpr size_t Slots = N ? ::std::bit_ceil(N * 2) : 1;
+         static constexpr size_t Buckets = N ? ::std::bit_ceil((N + 3) / 4) : 1;
+         static constexpr uint16_t Empty = ::std::numeric_limits<uint16_t>::max();
+         static_assert(N < Empty, "Too many names for a perfect hash");
+
+         ::std::array<uint32_t, Buckets> displacement {};
+         ::std::array<uint16_t, Slots> index {};
+
+         consteval PerfectHash(const ::std::array<::std::string_view, N>& names) {
+            ::std::array<uint64_t, N> hashes {};
+            for (size_t i = 0; i < N; ++i)
+               hashes[i] = HashView(names[i]);
+
+            ::std::array<size_t, Buckets> order {};
+            ::std::array<size_t, Buckets> sizes {};
+            for (size_t b = 0; b < Buckets; ++b)
+               order[b] = b;
+            for (auto h : hashes)
+               ++sizes[h & (Buckets - 1)];
+            ::std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+               return sizes[a] != sizes[b] ? sizes[a] > sizes[b] : a < b;
+            });
+
+            index.fill(Empty);
+            for (auto b : order) {
+               if (not sizes[b])
+                  break;
+
+               for (uint32_t d = 0; ; ++d) {
+                  ::std::array<size_t, N> taken {};
+                  size_t count = 0;
+                  bool fits = true;
+                  for (size_t i = 0; i < N and fits; ++i) {
+                     if ((hashes[i] & (Buckets - 1)) != b)
+                        continue;
+                     const auto slot = PerfectSlot(hashes[i], d, Slots - 1);
+                     fits = index[slot] == Empty
+                        and ::std::find(taken.begin(), taken.begin() + count, slot) == taken.begin() + count;
+                     taken[count++] = slot;
+                  }
+
+                  if (not fits)
+                     continue;
+
+                  displacement[b] = d;
+                  for (size_t i = 0, n = 0; i < N; ++i) {
+                     if ((hashes[i] & (Buckets - 1)) == b)
+                        index[taken[n++]] = static_cast<uint16_t>(i);
+                  }
+                  break;
+               }
+            }
+         }
+
+         /// Index of the name that could be the given string                 
+         constexpr size_t Find(::std::string_view s) const noexcept {
+            const auto h = HashView(s);
+            return index[PerfectSlot(h, displacement[h & (Buckets - 1)], Slots - 1)];
+         }
+      };
+   }
+
+   /// All enumerators of an enum within its enum_range, ascending            
+   template<class E> requires ::std::is_enum_v<E>
+   constexpr auto enum_values = Inner::EnumScan<E>(::std::make_index_sequence<Inner::EnumRangeSize<E>> {});
+
+   /// Names of the enumerators, in the same order as enum_values             
+   template<class E> requires ::std::is_enum_v<E>
+   constexpr auto enum_names = Inner::EnumNames<E, enum_values<E>>(
+      ::std::make_index_sequence<enum_values<E>.size()> {});
+
+   namespace Inner
+   {
+      template<class E>
+      constexpr PerfectHash<enum_names<E>.size()> EnumHash {enum_names<E>};
+   }
+
+   /// Name of an enumerator known only at runtime, or an empty view          
+   template<class E> requires ::std::is_enum_v<E>
+   constexpr ::std::string_view enum_name(E value) noexcept {
+      const auto found = ::std::ranges::lower_bound(enum_values<E>, value);
+      if (found == enum_values<E>.end() or *found != value)
+         return {};
+      return enum_names<E>[found - enum_values<E>.begin()];
+   }
+
+   ///                                                                        
+   /// Get an enumerator by its name, through a perfect hash generated at     
+   /// compile time - no parsing or tables built at startup, e.g.             
+   ///   enum_from_string<Color>("Red") == Color::Red                         
+   ///                                                                        
+   template<class E> requires ::std::is_enum_v<E>
+   constexpr ::std::optional<E> enum_from_string(::std::string_view name) noexcept {
+      const auto i = Inner::EnumHash<E>.Find(name);
+      if (i == Inner::EnumHash<E>.Empty or enum_names<E>[i] != name)
+         return ::std::nullopt;
+      return enum_values<E>[i];
+   }
+}
@@ -0,0 +1,143 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Pack.hpp"
+
+
+namespace Langulus
+{
+   template<literal_t...V> requires Inner::PackOfStrings<V...>
+   struct literal_set;
+
+   namespace Inner
+   {
+      /// Indices of some of the literals in a pack                           
+      template<size_t N>
+      struct SetPicks {
+         ::std::array<size_t, N> at {};
+         size_t count = 0;
+      };
+
+      /// Indices of the distinct literals of a pack, in sorted order         
+      template<class P>
+      consteval auto SetPickDistinct() {
+         SetPicks<P::size> result;
+         for (auto i : P::order) {
+            if (not result.count or P::views[result.at[result.count - 1]] != P::views[i])
+               result.at[result.count++] = i;
+         }
+         return result;
+      }
+
+      /// Indices of the literals of A that are also in B - A's order is kept 
+      template<class A, class B>
+      consteval auto SetPickCommon() {
+         SetPicks<A::size> result;
+         if constexpr (B::size > 0) {
+            for (size_t i = 0; i < A::size; ++i) {
+               if (B::find(A::views[i]) != B::npos)
+                  result.at[result.count++] = i;
+            }
+         }
+         return result;
+      }
+
+      template<class A, class B>
+      consteval bool SetSubset() {
+         if constexpr (A::size > B::size)
+            return false;
+         else if constexpr (A::size == 0)
+            return true;
+         else {
+            for (auto view : A::views) {
+               if (B::find(view) == B::npos)
+                  return false;
+            }
+            return true;
+         }
+      }
+
+      /// Literal I of a pack, with the capacity CTAD would give a string     
+      /// literal of the same text, so that "a" and literal_t<char, 16> {"a"} 
+      /// end up as the same set element                                      
+      template<class P, size_t I>
+      consteval auto SetElement() {
+         constexpr auto view = P::views[I];
+         literal_t<typename P::value_type, ::std::bit_ceil(view.size() + 1)> result;
+         for (size_t i = 0; i < view.size(); ++i)
+            result._data[i] = view[i];
+         return result;
+      }
+
+      template<class P, auto PICKS, class S = ::std::make_index_sequence<PICKS.count>>
+      struct SetPick;
+
+      template<class P, auto PICKS, size_t...K>
+      struct SetPick<P, PICKS, ::std::index_sequence<K...>> {
+         using type = literal_set<SetElement<P, PICKS.at[K]>()...>;
+      };
+
+      template<class P>
+      using SetOf = typename SetPick<P, SetPickDistinct<P>()>::type;
+   }
+
+
+   ///                                                                        
+   /// The canonical set of string literals V, e.g.                           
+   ///   literal_set_t<"vel", "pos", "vel"> is literal_set<"pos", "vel">      
+   /// Literals are sorted, deduplicated and resized to their CTAD capacity,  
+   /// so every spelling of the same set is the same type - use it to keep    
+   /// one instantiation per logical set, e.g.                                
+   ///   template<literal_t...C>                                              
+   ///   using Component = ComponentImpl<literal_set_t<C...>>;                
+   ///                                                                        
+   template<literal_t...V>
+   using literal_set_t = Inner::SetOf<literal_pack<V...>>;
+
+   ///                                                                        
+   /// A canonical set of string literals - don't spell it directly, get it   
+   /// through literal_set_t instead                                          
+   ///                                                                        
+   template<literal_t...V> requires Inner::PackOfStrings<V...>
+   struct literal_set {
+      using pack = literal_pack<V...>;
+      using value_type = typename pack::value_type;
+
+      static_assert(::std::same_as<literal_set, literal_set_t<V...>>,
+         "literal_set isn't canonical, use literal_set_t instead");
+
+      static constexpr size_t size = sizeof...(V);
+
+      template<literal_t NAME> requires CT::LiteralString<decltype(NAME)>
+      static constexpr bool contains = pack::template contains<NAME>;
+   };
+
+   namespace Inner
+   {
+      template<class A, class B>
+      struct SetUnion;
+
+      template<literal_t...A, literal_t...B>
+      struct SetUnion<literal_set<A...>, literal_set<B...>> {
+         using type = literal_set_t<A..., B...>;
+      };
+   }
+
+   /// Literals that are in either A or B                                     
+   template<class A, class B>
+   using set_union = typename Inner::SetUnion<A, B>::type;
+
+   /// Literals that are in both A and B                                      
+   template<class A, class B>
+   using set_intersection = typename Inner::SetPick<typename A::pack,
+      Inner::SetPickCommon<typename A::pack, typename B::pack>()>::type;
+
+   /// Check if all literals of A are also in B                               
+   template<class A, class B>
+   constexpr bool is_subset = Inner::SetSubset<typename A::pack, typename B::pack>();
+}
@@ -0,0 +1,251 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+#include <algorithm>
+#include <utility>
+
+/// The registry of all string IDs keeps every name in memory, so it's only   
+/// there in debug builds, unless explicitly requested                        
+#if defined(LANGULUS_OPTION_SID_REGISTRY) or not defined(NDEBUG)
+   #include <mutex>
+   #include <stdexcept>
+   #include <string>
+   #include <unordered_map>
+   #define lgls_sid_registry 1
+#else
+   #define lgls_sid_registry 0
+#endif
+
+
+namespace Langulus
+{
+   /// String IDs - distinct types, so they don't mix with other integers,    
+   /// or with each other                                                     
+   enum class sid64_t : uint64_t {};
+   enum class sid32_t : uint32_t {};
+
+   ///                                                                        
+   /// Version of the string ID function. Changing anything about it, like    
+   /// a constant, changes every persisted ID - so it must come with a new    
+   /// version, and the old one must stay available. Version 1:               
+   ///   1. h = 0x9E3779B97F4A7C15 xor (length in bytes)                      
+   ///   2. split the bytes into 8-byte words, zero-padding the last one,     
+   ///      and taking at least one word even for an empty string             
+   ///   3. for each word w, read as a little-endian integer:                 
+   ///         h = rotl((h xor w) * 0x87C37B91114253D5, 31)                   
+   ///   4. finalize like MurmurHash3's fmix64:                               
+   ///         h ^= h >> 33; h *= 0xFF51AFD7ED558CCD;                         
+   ///         h ^= h >> 33; h *= 0xC4CEB9FE1A85EC53; h ^= h >> 33            
+   ///   5. the 32-bit ID is (h xor (h >> 32)), truncated                     
+   /// Only bytes go in, assembled explicitly, so IDs are the same on any     
+   /// compiler, platform and build.                                          
+   ///                                                                        
+   constexpr unsigned SidVersion = 1;
+
+   namespace Inner
+   {
+      constexpr uint64_t SidV1(::std::string_view s) noexcept {
+         uint64_t h = 0x9E3779B97F4A7C15ull ^ s.size();
+         size_t i = 0;
+         do {
+            uint64_t w = 0;
+            for (size_t b = 0; b < 8 and i + b < s.size(); ++b)
+               w |= uint64_t {static_cast<uint8_t>(s[i + b])} << (8 * b);
+            h = ::std::rotl((h ^ w) * 0x87C37B91114253D5ull, 31);
+            i += 8;
+         }
+         while (i < s.size());
+
+         h ^= h >> 33;
+         h *= 0xFF51AFD7ED558CCDull;
+         h ^= h >> 33;
+         h *= 0xC4CEB9FE1A85EC53ull;
+         return h ^ (h >> 33);
+      }
+
+      template<class ID>
+      constexpr ID SidOf(::std::string_view s) noexcept {
+         const auto h = SidV1(s);
+         if constexpr (::std::same_as<ID, sid64_t>)
+            return static_cast<ID>(h);
+         else
+            return static_cast<ID>(static_cast<uint32_t>(h ^ (h >> 32)));
+      }
+
+      template<class...T>
+      concept SidLiteral = CT::LiteralString<T...>
+          and (::std::same_as<typename T::value_type, char> and ...);
+
+   #if lgls_sid_registry
+      ///                                                                     
+      /// Every string ID used in the program, by its name. Catches           
+      /// collisions across translation units at startup, and allows for      
+      /// turning IDs back into names when debugging                          
+      ///                                                                     
+      template<class ID>
+      class SidRegistry {
+         ::std::mutex _mutex;
+         ::std::unordered_map<ID, ::std::string> _names;
+
+      public:
+         static SidRegistry& Instance() {
+            static SidRegistry instance;
+            return instance;
+         }
+
+         /// Register a name, throws ::std::logic_error if a different name   
+         /// already has the same ID - during static initialization that      
+         /// terminates the program, before it ever persists a bad ID         
+         ID Register(::std::string_view name) {
+            const auto id = SidOf<ID>(name);
+            ::std::scoped_lock lock {_mutex};
+            const auto [it, fresh] = _names.try_emplace(id, name);
+            if (not fresh and it->second != name) {
+               throw ::std::logic_error {"String ID collision between \""
+                  + it->second + "\" and \"" + ::std::string {name} + '"'};
+            }
+            return id;
+         }
+
+         ::std::string_view Name(ID id) {
+            ::std::scoped_lock lock {_mutex};
+            const auto found = _names.find(id);
+            return found == _names.end() ? ::std::string_view {} : found->second;
+         }
+      };
+
+      /// Registers a literal's ID during static initialization, for every    
+      /// literal used with sid<L> or sid32<L>                                
+      template<class ID, literal_t L>
+      inline const bool SidRegistrar = (SidRegistry<ID>::Instance()
+         .Register(static_cast<::std::string_view>(L)), true);
+
+      template<class ID, literal_t L>
+      consteval ID SidOfLiteral() {
+         // Taking the address instantiates the registrar               
+         static_cast<void>(&SidRegistrar<ID, L>);
+         return SidOf<ID>(static_cast<::std::string_view>(L));
+      }
+   #else
+      template<class ID, literal_t L>
+      consteval ID SidOfLiteral() {
+         return SidOf<ID>(static_cast<::std::string_view>(L));
+      }
+   #endif
+   }
+
+
+   ///                                                                        
+   /// Stable string IDs of literals, computed at compile time, e.g.          
+   ///   switch (id) { case sid<"render.frame">: ... }                        
+   /// In debug builds every ID used this way is checked for collisions at    
+   /// startup, across the whole program                                      
+   ///                                                                        
+   template<literal_t L> requires Inner::SidLiteral<decltype(L)>
+   constexpr sid64_t sid = Inner::SidOfLiteral<sid64_t, L>();
+
+   template<literal_t L> requires Inner::SidLiteral<decltype(L)>
+   constexpr sid32_t sid32 = Inner::SidOfLiteral<sid32_t, L>();
+
+   /// Stable string IDs of strings that arrive at runtime                    
+   constexpr sid64_t make_sid(::std::string_view name) noexcept {
+      return Inner::SidOf<sid64_t>(name);
+   }
+
+   constexpr sid32_t make_sid32(::std::string_view name) noexcept {
+      return Inner::SidOf<sid32_t>(name);
+   }
+
+   ///                                                                        
+   /// Register a runtime name for collision checks and reverse lookups, in   
+   /// builds that have a registry; just computes the ID in the others        
+   ///   @attention throws ::std::logic_error on a collision                  
+   ///                                                                        
+   template<class ID = sid64_t>
+   ID register_sid(::std::string_view name) {
+   #if lgls_sid_registry
+      return Inner::SidRegistry<ID>::Instance().Register(name);
+   #else
+      return Inner::SidOf<ID>(name);
+   #endif
+   }
+
+   ///                                                                        
+   /// Get the name of a registered ID, for debugging - always empty in       
+   /// builds without a registry                                              
+   ///                                                                        
+   template<class ID>
+      requires (::std::same_as<ID, sid64_t> or ::std::same_as<ID, sid32_t>)
+   ::std::string_view sid_name(ID id) {
+   #if lgls_sid_registry
+      return Inner::SidRegistry<ID>::Instance().Name(id);
+   #else
+      static_cast<void>(id);
+      return {};
+   #endif
+   }
+
+   ///                                                                        
+   /// A set of string IDs, checked for collisions at compile time            
+   ///                                                                        
+   /// Declare all IDs of a subsystem in one place, and a collision fails     
+   /// the build, instead of the program's startup:                           
+   ///   using RenderIds = sid_registry<"render.frame", "render.pass">;       
+   ///   RenderIds::get<"render.pass">                                        
+   ///   RenderIds::name(id)  // works in constexpr and in release builds     
+   ///                                                                        
+   template<class ID, literal_t...L> requires Inner::SidLiteral<decltype(L)...>
+   struct basic_sid_registry {
+      static constexpr size_t size = sizeof...(L);
+      static constexpr ::std::array<::std::string_view, size> names {
+         static_cast<::std::string_view>(L)...
+      };
+      static constexpr ::std::array<ID, size> ids {
+         Inner::SidOfLiteral<ID, L>()...
+      };
+
+   private:
+      /// Same names are fine, same IDs of different names are not            
+      static consteval bool Unique() {
+         ::std::array<::std::pair<ID, ::std::string_view>, size> sorted;
+         for (size_t i = 0; i < size; ++i)
+            sorted[i] = {ids[i], names[i]};
+         ::std::sort(sorted.begin(), sorted.end());
+         for (size_t i = 1; i < size; ++i) {
+            if (sorted[i - 1].first == sorted[i].first
+            and sorted[i - 1].second != sorted[i].second)
+               return false;
+         }
+         return true;
+      }
+
+      static_assert(Unique(), "Two different names in a sid registry have the same ID");
+
+   public:
+      template<literal_t K> requires ((static_cast<::std::string_view>(K)
+         == static_cast<::std::string_view>(L)) or ...)
+      static constexpr ID get = Inner::SidOfLiteral<ID, K>();
+
+      static constexpr bool contains(ID id) noexcept {
+         return ::std::ranges::find(ids, id) != ids.end();
+      }
+
+      /// Name of an ID in the set, or an empty view                          
+      static constexpr ::std::string_view name(ID id) noexcept {
+         const auto found = ::std::ranges::find(ids, id);
+         return found == ids.end() ? ::std::string_view {} : names[found - ids.begin()];
+      }
+   };
+
+   template<literal_t...L>
+   using sid_registry = basic_sid_registry<sid64_t, L...>;
+
+   template<literal_t...L>
+   using sid32_registry = basic_sid_registry<sid32_t, L...>;
+}
@@ -0,0 +1,300 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Span.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      ///                                                                     
+      /// MSD radix sort over the raw characters of same-capacity literals    
+      ///                                                                     
+      /// Since all literals in a span have the same capacity, every one of   
+      /// them is just N characters, padded with zeroes after the terminator. 
+      /// Sorting them byte by byte, most significant first, orders them      
+      /// exactly like operator <=>, without ever computing a size or going   
+      /// through char_traits.                                                
+      ///                                                                     
+      template<class T, size_t N>
+      struct RadixSorter {
+         using literal = literal_t<T, N>;
+         using lane_t = ::std::make_unsigned_t<T>;
+
+         /// Number of byte-sized digits in each literal                      
+         static constexpr size_t Digits = N * sizeof(T);
+
+         /// Buckets smaller than this are finished by comparison sorting     
+         static constexpr size_t SmallBucket = 64;
+
+         /// Top-level buckets for the parallel sort, two digits' worth       
+         static constexpr size_t TopBuckets = Digits > 1 ? 65536 : 256;
+
+         /// Character as compared by char_traits - unsigned, except for a    
+         /// signed wchar_t, which gets its sign bit flipped to keep order    
+         lgls_inline static lane_t Key(T c) noexcept {
+            auto key = static_cast<lane_t>(c);
+            if constexpr (sizeof(T) > 1 and ::std::is_signed_v<T>)
+               key ^= static_cast<lane_t>(lane_t {1} << (sizeof(T) * 8 - 1));
+            return key;
+         }
+
+         /// Get digit 'd', counted from the most significant one             
+         lgls_inline static uint8_t Digit(const literal& s, size_t d) noexcept {
+            if constexpr (sizeof(T) == 1)
+               return static_cast<uint8_t>(s._data[d]);
+            else {
+               const auto key = Key(s._data[d / sizeof(T)]);
+               return static_cast<uint8_t>(key >> (8 * (sizeof(T) - 1 - d % sizeof(T))));
+            }
+         }
+
+         /// The first two digits, for the top-level parallel partition       
+         lgls_inline static size_t TopDigit(const literal& s) noexcept {
+            if constexpr (Digits > 1)
+               return size_t {Digit(s, 0)} << 8 | Digit(s, 1);
+            else
+               return Digit(s, 0);
+         }
+
+         /// Is a bucket made only of literals that already ended - with      
+         /// byte characters a zero digit is always a terminator              
+         static constexpr bool Ended(size_t bucket) noexcept {
+            return sizeof(T) == 1 and (bucket == 0
+               or (TopBuckets == 65536 and (bucket & 0xFF) == 0));
+         }
+
+         /// Zero everything after the terminator, so padding can't affect    
+         /// the order                                                        
+         static void Normalize(literal& s) noexcept {
+            size_t i = 0;
+            while (i < N and s._data[i])
+               ++i;
+            ::std::char_traits<T>::assign(s._data.data() + i, N + 1 - i, T {});
+         }
+
+         /// Lexicographic compare, starting at a digit, assuming all the     
+         /// previous digits are the same                                     
+         static bool Less(const literal& a, const literal& b, size_t digit) noexcept {
+            if constexpr (sizeof(T) == 1) {
+               return ::std::memcmp(a._data.data() + digit, b._data.data() + digit, N - digit) < 0;
+            }
+            else {
+               for (size_t i = digit / sizeof(T); i < N; ++i) {
+                  if (a._data[i] != b._data[i])
+                     return Key(a._data[i]) < Key(b._data[i]);
+               }
+               return false;
+            }
+         }
+
+         /// Sort a range, starting at the given digit. Scratch must be at    
+         /// least as big as the range                                        
+         static void Sort(literal* first, literal* last, literal* scratch, size_t digit) {
+            while (true) {
+               const size_t count = last - first;
+               if (count < 2 or digit == Digits)
+                  return;
+
+               if (count < SmallBucket) {
+                  ::std::sort(first, last, [digit](const literal& a, const literal& b) {
+                     return Less(a, b, digit);
+                  });
+                  return;
+               }
+
+               size_t offsets[257] {};
+               for (auto it = first; it != last; ++it)
+                  ++offsets[Digit(*it, digit) + 1];
+
+               // Skip digits shared by everything, without scattering  
+               const auto lead = Digit(*first, digit);
+               if (offsets[lead + 1] == count) {
+                  if (sizeof(T) == 1 and lead == 0)
+                     return;
+                  ++digit;
+                  continue;
+               }
+
+               for (size_t b = 1; b < 257; ++b)
+                  offsets[b] += offsets[b - 1];
+
+               size_t cursor[256];
+               ::std::copy_n(offsets, 256, cursor);
+               for (auto it = first; it != last; ++it)
+                  scratch[cursor[Digit(*it, digit)]++] = *it;
+               ::std::copy(scratch, scratch + count, first);
+
+               for (size_t b = Ended(0) ? 1 : 0; b < 256; ++b) {
+                  Sort(first + offsets[b], first + offsets[b + 1],
+                     scratch + offsets[b], digit + 1);
+               }
+               return;
+            }
+         }
+      };
+
+      /// Raw, uninitialized storage for the scratch buffer                   
+      template<class T>
+      struct Scratch {
+         ::std::allocator<T> _allocator;
+         T* _data;
+         size_t _count;
+
+         explicit Scratch(size_t count)
+            : _data {_allocator.allocate(count)}, _count {count} {}
+
+         ~Scratch() {
+            _allocator.deallocate(_data, _count);
+         }
+      };
+
+      ///                                                                     
+      /// The parts of radix_sort and parallel_radix_sort that depend only on 
+      /// the literal type, so that they're instantiated once per literal_t,  
+      /// no matter the range                                                 
+      ///                                                                     
+      template<class T, size_t N>
+      void RadixSort(::std::span<literal_t<T, N>> data) {
+         using Sorter = RadixSorter<T, N>;
+         if (data.size() < 2)
+            return;
+
+         for (auto& s : data)
+            Sorter::Normalize(s);
+
+         Scratch<literal_t<T, N>> scratch {data.size()};
+         Sorter::Sort(data.data(), data.data() + data.size(), scratch._data, 0);
+      }
+
+      template<class T, size_t N>
+      void ParallelRadixSort(::std::span<literal_t<T, N>> data, unsigned threads) {
+         using Sorter = RadixSorter<T, N>;
+         constexpr size_t MinPerThread = 1 << 16;
+         threads = ::std::max(1u, ::std::min<unsigned>(threads, data.size() / MinPerThread));
+         if (threads == 1)
+            return RadixSort(data);
+
+         // Normalize in parallel, each worker gets a contiguous chunk  
+         const auto parallel = [threads](auto&& job) {
+            ::std::vector<::std::jthread> pool;
+            pool.reserve(threads - 1);
+            for (unsigned t = 1; t < threads; ++t)
+               pool.emplace_back(job, t);
+            job(0u);
+         };
+
+         parallel([&](unsigned t) {
+            const auto chunk = (data.size() + threads - 1) / threads;
+            const auto from = ::std::min(data.size(), t * chunk);
+            const auto to = ::std::min(data.size(), from + chunk);
+            for (auto i = from; i < to; ++i)
+               Sorter::Normalize(data[i]);
+         });
+
+         // Partition by the top digits                                 
+         ::std::vector<size_t> offsets(Sorter::TopBuckets + 1);
+         for (auto& s : data)
+            ++offsets[Sorter::TopDigit(s) + 1];
+         for (size_t b = 1; b <= Sorter::TopBuckets; ++b)
+            offsets[b] += offsets[b - 1];
+
+         Scratch<literal_t<T, N>> scratch {data.size()};
+         {
+            auto cursor = offsets;
+            for (auto& s : data)
+               scratch._data[cursor[Sorter::TopDigit(s)]++] = s;
+            ::std::copy(scratch._data, scratch._data + data.size(), data.data());
+         }
+
+         // Sort the buckets, biggest first                             
+         ::std::vector<uint32_t> order;
+         for (size_t b = 0; b < Sorter::TopBuckets; ++b) {
+            if (offsets[b + 1] - offsets[b] > 1 and not Sorter::Ended(b))
+               order.push_back(static_cast<uint32_t>(b));
+         }
+         ::std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+         });
+
+         ::std::atomic<size_t> next = 0;
+         parallel([&](unsigned) {
+            for (auto i = next++; i < order.size(); i = next++) {
+               const auto b = order[i];
+               Sorter::Sort(data.data() + offsets[b], data.data() + offsets[b + 1],
+                  scratch._data + offsets[b], Sorter::TopBuckets == 65536 ? 2 : 1);
+            }
+         });
+      }
+   }
+
+
+   ///                                                                        
+   /// Sort same-capacity literals in place, in the order of operator <=>     
+   ///   @attention anything past a literal's terminator is zeroed            
+   ///                                                                        
+   template<CT::LiteralSpan R>
+   void radix_sort(R&& range) {
+      using literal = ::std::ranges::range_value_t<R>;
+      Inner::RadixSort(::std::span<literal> {range});
+   }
+
+   ///                                                                        
+   /// Sort same-capacity literals in place, using several threads            
+   ///                                                                        
+   /// The whole range is partitioned by its first two digits in one pass,    
+   /// and then the resulting buckets are sorted by a pool of workers, the    
+   /// biggest buckets first.                                                 
+   ///   @attention anything past a literal's terminator is zeroed            
+   ///                                                                        
+   template<CT::LiteralSpan R>
+   void parallel_radix_sort(R&& range, unsigned threads = ::std::thread::hardware_concurrency()) {
+      using literal = ::std::ranges::range_value_t<R>;
+      Inner::ParallelRadixSort(::std::span<literal> {range}, threads);
+   }
+
+   ///                                                                        
+   /// Binary searches over sorted literals, in the order of operator <=>     
+   ///                                                                        
+   template<CT::LiteralSpan R>
+   auto lower_bound(const R& range, const CT::LiteralString auto& key) noexcept {
+      return ::std::ranges::partition_point(range,
+         [&key](const auto& s) { return (s <=> key) < 0; });
+   }
+
+   template<CT::LiteralSpan R>
+   auto upper_bound(const R& range, const CT::LiteralString auto& key) noexcept {
+      return ::std::ranges::partition_point(range,
+         [&key](const auto& s) { return (s <=> key) <= 0; });
+   }
+
+   /// Get the subspan of literals equal to the key                           
+   template<CT::LiteralSpan R>
+   auto equal_range(const R& range, const CT::LiteralString auto& key) noexcept {
+      using literal = ::std::ranges::range_value_t<R>;
+      const ::std::span<const literal> data {range};
+      const auto first = lower_bound(data, key);
+      const auto rest = data.subspan(first - data.begin());
+      return ::std::span<const literal> {first, upper_bound(rest, key)};
+   }
+}
+
+#ifdef LANGULUS_OPTION_PREBUILT
+   #define lgls_prebuilt_literal(T, N) \
+      extern template void ::Langulus::Inner::RadixSort<T, N>( \
+         ::std::span<::Langulus::literal_t<T, N>>); \
+      extern template void ::Langulus::Inner::ParallelRadixSort<T, N>( \
+         ::std::span<::Langulus::literal_t<T, N>>, unsigned);
+   #include "Prebuilt.inl"
+#endif
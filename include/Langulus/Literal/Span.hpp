@@ -0,0 +1,24 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "../Literal.hpp"
+#include <ranges>
+#include <span>
+
+
+namespace Langulus::CT
+{
+   /// Contiguous range of same-capacity literal_t strings                    
+   template<class R>
+   concept LiteralSpan = ::std::ranges::contiguous_range<R>
+       and ::std::ranges::sized_range<R>
+       and LiteralString<::std::ranges::range_value_t<R>>
+       and ::std::same_as<::std::ranges::range_value_t<R>, literal_t<
+              typename ::std::ranges::range_value_t<R>::value_type,
+              ::std::ranges::range_value_t<R>::ArraySize>>;
+}
@@ -0,0 +1,368 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Sid.hpp"
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#if defined(__x86_64__) or defined(__i386__)
+   #include <x86intrin.h>
+   #define lgls_rdtsc() __rdtsc()
+#elif defined(_M_X64) or defined(_M_IX86)
+   #include <intrin.h>
+   #define lgls_rdtsc() __rdtsc()
+#endif
+
+
+namespace Langulus
+{
+   namespace Inner
+   {
+      /// A timestamp in the cheapest units available - TSC ticks on x86,     
+      /// steady clock ticks anywhere else. Converted to time only when       
+      /// drained, see trace_file::flush()                                    
+      lgls_inline uint64_t TraceTicks() noexcept {
+      #ifdef lgls_rdtsc
+         return lgls_rdtsc();
+      #else
+         return static_cast<uint64_t>(::std::chrono::steady_clock::now().time_since_epoch().count());
+      #endif
+      }
+
+      /// A finished scope - the thread it happened on is implied by the      
+      /// buffer it is in                                                     
+      struct TraceEvent {
+         uint64_t begin;
+         uint64_t end;
+         uint32_t id;
+      };
+
+      /// Name of a scope, registered once per name, for the drain            
+      struct TraceName {
+         uint32_t id;
+         ::std::string_view name;
+         TraceName* next;
+      };
+
+      ///                                                                     
+      /// A single-producer, single-consumer ring of events, one per thread   
+      ///                                                                     
+      /// The owning thread is the only one that writes events and the head,  
+      /// and the drain is the only one that moves the tail. When the ring    
+      /// is full, new events are dropped and counted, so the producer never  
+      /// waits. Buffers outlive their threads, and are reused by new threads 
+      /// once drained.                                                       
+      ///                                                                     
+      struct TraceBuffer {
+         static constexpr size_t Capacity = 1 << 15;
+
+         TraceEvent events[Capacity];
+
+         alignas(64) ::std::atomic<uint64_t> head {};
+         uint64_t cachedTail = 0;
+         ::std::atomic<uint64_t> dropped {};
+
+         alignas(64) ::std::atomic<uint64_t> tail {};
+         ::std::atomic<bool> owned {true};
+         uint32_t thread = 0;
+         TraceBuffer* next = nullptr;
+
+         lgls_inline void Push(const TraceEvent& event) noexcept {
+            const auto h = head.load(::std::memory_order_relaxed);
+            if (h - cachedTail == Capacity) {
+               cachedTail = tail.load(::std::memory_order_acquire);
+               if (h - cachedTail == Capacity) {
+                  dropped.store(dropped.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+                  return;
+               }
+            }
+
+            events[h & (Capacity - 1)] = event;
+            head.store(h + 1, ::std::memory_order_release);
+         }
+      };
+
+      ///                                                                     
+      /// All trace buffers and names in the program                          
+      ///                                                                     
+      class Tracer {
+         static inline constinit ::std::atomic<TraceBuffer*> Buffers {nullptr};
+         static inline constinit ::std::atomic<TraceName*> Names {nullptr};
+         static inline constinit ::std::atomic<uint32_t> Threads {0};
+         static inline constinit ::std::atomic<int> Sessions {0};
+
+         /// Gives the buffer back for reuse, when the thread ends            
+         struct Owner {
+            TraceBuffer* buffer = nullptr;
+
+            ~Owner() {
+               if (buffer)
+                  buffer->owned.store(false, ::std::memory_order_release);
+            }
+         };
+
+         /// Reuse a drained buffer of a finished thread, or make a new one   
+         static TraceBuffer* Acquire() {
+            for (auto b = Buffers.load(::std::memory_order_acquire); b; b = b->next) {
+               bool owned = false;
+               if (b->head.load(::std::memory_order_relaxed) == b->tail.load(::std::memory_order_acquire)
+               and b->owned.compare_exchange_strong(owned, true, ::std::memory_order_acquire)) {
+                  b->thread = Threads.fetch_add(1, ::std::memory_order_relaxed) + 1;
+                  return b;
+               }
+            }
+
+            auto b = new TraceBuffer;
+            b->thread = Threads.fetch_add(1, ::std::memory_order_relaxed) + 1;
+            b->next = Buffers.load(::std::memory_order_relaxed);
+            while (not Buffers.compare_exchange_weak(b->next, b,
+               ::std::memory_order_release, ::std::memory_order_relaxed));
+            return b;
+         }
+
+         /// The calling thread's buffer - trivially destructible, so it's    
+         /// accessed without any thread_local initialization checks          
+         static inline thread_local constinit TraceBuffer* Current = nullptr;
+
+         /// Get a buffer for the calling thread, and give it back when the   
+         /// thread ends                                                      
+         static TraceBuffer* Own() noexcept {
+            thread_local Owner owner;
+            // Out of memory just means no tracing for this thread      
+            try { owner.buffer = Acquire(); }
+            catch (...) { return nullptr; }
+            return Current = owner.buffer;
+         }
+
+      public:
+         static bool Register(TraceName* name) noexcept {
+            name->next = Names.load(::std::memory_order_relaxed);
+            while (not Names.compare_exchange_weak(name->next, name,
+               ::std::memory_order_release, ::std::memory_order_relaxed));
+            return true;
+         }
+
+         lgls_inline static bool Enabled() noexcept {
+            return Sessions.load(::std::memory_order_relaxed) > 0;
+         }
+
+         /// Begin the only session, or return false if one is running     
+         static bool Start() noexcept {
+            int none = 0;
+            return Sessions.compare_exchange_strong(none, 1, ::std::memory_order_acquire);
+         }
+
+         static void Stop() noexcept {
+            Sessions.store(0, ::std::memory_order_release);
+         }
+
+         lgls_inline static void Record(uint32_t id, uint64_t begin, uint64_t end) noexcept {
+            auto buffer = Current;
+            if (not buffer) [[unlikely]] {
+               buffer = Own();
+               if (not buffer)
+                  return;
+            }
+            buffer->Push({begin, end, id});
+         }
+
+         /// Visit all names registered so far                                
+         template<class F>
+         static void ForEachName(F&& f) {
+            for (auto n = Names.load(::std::memory_order_acquire); n; n = n->next)
+               f(*n);
+         }
+
+         /// Take all events recorded so far out of the buffers. Only the     
+         /// session started with Start() may drain, one call at a time       
+         template<class F>
+         static uint64_t Drain(F&& f) {
+            uint64_t dropped = 0;
+            for (auto b = Buffers.load(::std::memory_order_acquire); b; b = b->next) {
+               const auto h = b->head.load(::std::memory_order_acquire);
+               for (auto t = b->tail.load(::std::memory_order_relaxed); t != h; ++t)
+                  f(b->events[t & (TraceBuffer::Capacity - 1)], b->thread);
+               b->tail.store(h, ::std::memory_order_release);
+               dropped += b->dropped.load(::std::memory_order_relaxed);
+            }
+            return dropped;
+         }
+      };
+   }
+
+
+   ///                                                                        
+   /// Traces the time from its construction to its destruction, e.g.         
+   ///   trace_scope<"db.query"> scope;                                       
+   ///                                                                        
+   /// The name becomes a 32-bit string ID at compile time, so the hot path   
+   /// only reads the timestamp counter twice, and pushes a 24-byte record    
+   /// into the calling thread's ring buffer - no strings, no locks, no       
+   /// shared writes. Nothing is recorded while no trace_file is open.        
+   ///                                                                        
+   template<literal_t NAME> requires Inner::SidLiteral<decltype(NAME)>
+   class trace_scope {
+   public:
+      static constexpr uint32_t id = static_cast<uint32_t>(sid32<NAME>);
+
+   private:
+      static inline constinit Inner::TraceName Name {id, static_cast<::std::string_view>(NAME), nullptr};
+      static inline const bool Registered = Inner::Tracer::Register(&Name);
+
+      uint64_t _begin;
+
+   public:
+      trace_scope() noexcept
+         : _begin {Inner::Tracer::Enabled() ? Inner::TraceTicks() : 0} {
+         static_cast<void>(&Registered);
+      }
+
+      /// Nothing is recorded if the trace file closed in the meantime        
+      ~trace_scope() {
+         if (_begin and Inner::Tracer::Enabled())
+            Inner::Tracer::Record(id, _begin, Inner::TraceTicks());
+      }
+
+      trace_scope(const trace_scope&) = delete;
+      trace_scope& operator = (const trace_scope&) = delete;
+   };
+
+
+   ///                                                                        
+   /// Records traces into a Chrome trace event JSON file, that loads in      
+   /// chrome://tracing and ui.perfetto.dev                                   
+   ///                                                                        
+   /// Tracing is enabled while it exists. A background thread drains the     
+   /// ring buffers periodically - that's where names are looked up, times    
+   /// converted and text formatted, away from the traced threads. Only one   
+   /// trace_file can be open at a time, opening another one throws           
+   /// ::std::logic_error.                                                    
+   ///                                                                        
+   class trace_file {
+      ::std::ofstream _file;
+      ::std::mutex _mutex;
+      ::std::unordered_map<uint32_t, ::std::string_view> _names;
+      bool _first = true;
+      uint64_t _dropped = 0;
+
+      /// Ticks and time at the start, to convert ticks to microseconds       
+      uint64_t _originTicks;
+      ::std::chrono::steady_clock::time_point _originTime;
+      ::std::jthread _thread;
+
+      void WriteEvent(const Inner::TraceEvent& e, uint32_t thread, double ticksPerUs) {
+         // Scopes that began before this file belong to an earlier one 
+         if (e.begin < _originTicks)
+            return;
+
+         auto name = _names.find(e.id);
+         if (name == _names.end()) {
+            _names.clear();
+            Inner::Tracer::ForEachName([&](const Inner::TraceName& n) {
+               _names.emplace(n.id, n.name);
+            });
+            name = _names.find(e.id);
+         }
+
+         char buffer[32];
+         const auto number = [&](double value) {
+            const auto [end, error] = ::std::to_chars(buffer, buffer + sizeof(buffer),
+               value, ::std::chars_format::fixed, 3);
+            _file.write(buffer, end - buffer);
+         };
+
+         _file << (_first ? "\n" : ",\n") << R"({"name":")";
+         for (char c : name == _names.end() ? ::std::string_view {"?"} : name->second) {
+            if (c == '"' or c == '\\')
+               _file << '\\';
+            _file << c;
+         }
+         _file << R"(","ph":"X","pid":1,"tid":)" << thread << R"(,"ts":)";
+         number(static_cast<double>(e.begin - _originTicks) / ticksPerUs);
+         _file << R"(,"dur":)";
+         number(static_cast<double>(e.end - e.begin) / ticksPerUs);
+         _file << '}';
+         _first = false;
+      }
+
+   public:
+      explicit trace_file(const ::std::filesystem::path& path,
+         ::std::chrono::milliseconds period = ::std::chrono::milliseconds {100})
+         : _originTicks {Inner::TraceTicks()}
+         , _originTime {::std::chrono::steady_clock::now()} {
+         // Two sessions would drain the same rings concurrently, so    
+         // the file isn't even opened, or it could truncate the other  
+         if (not Inner::Tracer::Start())
+            throw ::std::logic_error {"Only one trace_file can be open at a time"};
+
+         try {
+            _file.open(path, ::std::ios::binary | ::std::ios::trunc);
+            if (not _file)
+               throw ::std::runtime_error {"Can't open trace file " + path.string()};
+
+            _file << R"({"displayTimeUnit":"ns","traceEvents":[)";
+            _thread = ::std::jthread {[this, period](::std::stop_token stop) {
+               ::std::mutex mutex;
+               ::std::condition_variable_any wake;
+               ::std::unique_lock lock {mutex};
+               while (true) {
+                  wake.wait_for(lock, stop, period, [] { return false; });
+                  if (stop.stop_requested())
+                     return;
+                  flush();
+               }
+            }};
+         }
+         catch (...) {
+            Inner::Tracer::Stop();
+            throw;
+         }
+      }
+
+      ~trace_file() {
+         _thread.request_stop();
+         _thread.join();
+         flush();
+         _file << "\n]}\n";
+
+         // Last, or the next trace_file could drain alongside flush()  
+         Inner::Tracer::Stop();
+      }
+
+      trace_file(const trace_file&) = delete;
+      trace_file& operator = (const trace_file&) = delete;
+
+      /// Drain everything recorded so far into the file                      
+      void flush() {
+         ::std::scoped_lock lock {_mutex};
+         const auto elapsed = ::std::chrono::duration<double, ::std::micro> {
+            ::std::chrono::steady_clock::now() - _originTime}.count();
+         const auto ticks = static_cast<double>(Inner::TraceTicks() - _originTicks);
+         const auto ticksPerUs = elapsed > 0 and ticks > 0 ? ticks / elapsed : 1.0;
+
+         _dropped = Inner::Tracer::Drain([&](const Inner::TraceEvent& e, uint32_t thread) {
+            WriteEvent(e, thread, ticksPerUs);
+         });
+         _file.flush();
+      }
+
+      /// Events dropped so far, because a ring buffer was full               
+      uint64_t dropped() noexcept {
+         ::std::scoped_lock lock {_mutex};
+         return _dropped;
+      }
+   };
+}
@@ -0,0 +1,38 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Module interface for <Langulus/Literal.hpp> - the header is parsed once,  
+/// when building the module, instead of in every TU that includes it. The    
+/// header stays the source of truth, this unit only picks what's exported    
+///                                                                           
+module;
+#include <Langulus/Literal.hpp>
+
+export module Langulus.Literal;
+
+export namespace Langulus
+{
+   using ::Langulus::Unsupported;
+   using ::Langulus::Token;
+   using ::Langulus::literal_t;
+   using ::Langulus::HashLiteral;
+
+   using ::Langulus::operator ==;
+   using ::Langulus::operator <=>;
+   using ::Langulus::operator +;
+
+   namespace CT
+   {
+      using ::Langulus::CT::Complete;
+      using ::Langulus::CT::Validate;
+      using ::Langulus::CT::Literal;
+      using ::Langulus::CT::LiteralChar;
+      using ::Langulus::CT::LiteralString;
+      using ::Langulus::CT::LiteralValue;
+      using ::Langulus::CT::LiteralUndefined;
+   }
+}
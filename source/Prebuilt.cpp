@@ -0,0 +1,30 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Explicit instantiation definitions for everything Prebuilt.hpp,           
+/// HashBatch.hpp and Sort.hpp declare extern template - all of Prebuilt.inl  
+///                                                                           
+#include <Langulus/Literal.hpp>
+#include <Langulus/Literal/HashBatch.hpp>
+#include <Langulus/Literal/Sort.hpp>
+
+#define lgls_prebuilt_literal(T, N) \
+   template struct ::Langulus::literal_t<T, N>; \
+   template void ::Langulus::Inner::HashBatch<T, N>( \
+      ::std::span<const ::Langulus::literal_t<T, N>>, ::std::span<uint64_t>) lgls_has_assumptions; \
+   template void ::Langulus::Inner::RadixSort<T, N>( \
+      ::std::span<::Langulus::literal_t<T, N>>); \
+   template void ::Langulus::Inner::ParallelRadixSort<T, N>( \
+      ::std::span<::Langulus::literal_t<T, N>>, unsigned);
+
+#define lgls_prebuilt_type(T) \
+   namespace Langulus::Inner { \
+      template struct Text<T>; \
+      template uint64_t HashView<T>(::std::basic_string_view<T>) noexcept; \
+   }
+
+#include <Langulus/Literal/Prebuilt.inl>
@@ -0,0 +1,5 @@
+#version 450
+// comment
+void main() {
+   gl_Position = vec4(0.0);
+}
@@ -0,0 +1,113 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Any.hpp>
+#include <unordered_set>
+
+using namespace Langulus;
+
+namespace
+{
+   template<literal_t NAME>
+   struct Component {
+      static constexpr auto name = NAME;
+   };
+
+   /// Not a template, yet takes literals of any type and capacity            
+   size_t CountVowels(any_literal text) {
+      size_t count = 0;
+      for (auto pos = text.find_first_of("aeiou"); pos != any_literal::npos;
+         pos = text.find_first_of("aeiou", pos + 1))
+         ++count;
+      return count;
+   }
+}
+
+
+///                                                                           
+/// any_literal                                                               
+///                                                                           
+SCENARIO("Testing type-erased literals", "[any]") {
+   static_assert(::std::is_trivially_copyable_v<any_literal>);
+
+   // Length and hash are known at compile time                         
+   constexpr any_literal pos = Component<"pos">::name;
+   static_assert(pos.size() == 3);
+   static_assert(pos.hash() == literal_t {"pos"}.hash());
+   static_assert(pos.kind() == any_literal::Kind::Char);
+   static_assert(pos.view<char>() == "pos");
+   static_assert(pos == "pos");
+   static_assert(pos == ::std::string_view {"pos"});
+   static_assert(pos != "vel");
+
+   constexpr any_literal wide = Component<u"pos">::name;
+   static_assert(wide.is<char16_t>());
+   static_assert(wide.hash() == literal_t {u"pos"}.hash());
+   static_assert(wide != pos);
+   static_assert(pos < wide);
+
+   constexpr any_literal empty;
+   static_assert(empty.empty());
+   static_assert(empty == "");
+   static_assert(empty.hash() == literal_t {""}.hash());
+
+   GIVEN("A literal of some capacity") {
+      static constexpr literal_t<char, 64> text {"the quick brown fox"};
+      const any_literal any = text;
+
+      THEN("It is searchable without knowing the capacity") {
+         REQUIRE(any.size() == text.size());
+         REQUIRE(any.hash() == text.hash());
+         REQUIRE(any.find("quick") == text.find("quick"));
+         REQUIRE(any.find('q') == 4);
+         REQUIRE(any.find(U'q') == 4);
+         REQUIRE(any.find(U'\x1F98A') == any_literal::npos);
+         REQUIRE(any_literal {"caf\xE9"}.find('\xE9') == 3);
+         REQUIRE(any.find(u"quick") == any_literal::npos);
+         REQUIRE(any.rfind('o') == text.rfind('o'));
+         REQUIRE(any.find_first_of("xyz") == text.find_first_of("xyz"));
+         REQUIRE(any.find_last_of("aeiou") == text.find_last_of("aeiou"));
+         REQUIRE(any.find_first_not_of("the ") == text.find_first_not_of("the "));
+         REQUIRE(any.find_last_not_of("fox") == text.find_last_not_of("fox"));
+         REQUIRE(any.starts_with("the"));
+         REQUIRE(any.starts_with('t'));
+         REQUIRE(any.ends_with("fox"));
+         REQUIRE(not any.ends_with('t'));
+         REQUIRE(any.contains("brown"));
+         REQUIRE(not any.contains("lazy"));
+         REQUIRE(any.substr(4, 5) == "quick");
+         REQUIRE(any.substr(4, 5).hash() == literal_t {"quick"}.hash());
+      }
+
+      THEN("It compares like a string") {
+         REQUIRE(any.compare("the quick brown fox") == 0);
+         REQUIRE(any.compare("the") > 0);
+         REQUIRE(any.compare("zzz") < 0);
+         REQUIRE(any < any_literal {"zzz"});
+         REQUIRE(::std::hash<any_literal> {}(any) == static_cast<size_t>(text.hash()));
+      }
+
+      THEN("It can be passed to non-template code") {
+         REQUIRE(CountVowels(any) == 5);
+         REQUIRE(CountVowels(Component<"aeiou">::name) == 5);
+         REQUIRE(CountVowels(u"aeiou") == 0);
+      }
+   }
+
+   GIVEN("A set of literals of different kinds and capacities") {
+      const ::std::unordered_set<any_literal> set {
+         Component<"pos">::name, Component<"velocity">::name, Component<u"pos">::name
+      };
+
+      REQUIRE(set.size() == 3);
+      REQUIRE(set.contains("pos"));
+      REQUIRE(set.contains(u"pos"));
+      REQUIRE(set.contains(::std::string_view {"velocity"}));
+      REQUIRE(not set.contains(U"pos"));
+   }
+}
@@ -0,0 +1,52 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include "shader.hpp"
+#include "empty.hpp"
+
+using namespace Langulus;
+
+
+///                                                                           
+/// langulus_embed_literal, literal_from_bytes                                
+///                                                                           
+TEST_CASE("Files embedded at build time", "[embed]") {
+   using Embedded::shader;
+   using Embedded::empty;
+
+   // Contents, size and hash are all known at compile time             
+   static_assert(::std::same_as<decltype(shader), const literal_t<char, 128>>);
+   static_assert(shader.size() == 68);
+   static_assert(shader.starts_with("#version 450\n"));
+   static_assert(shader.ends_with("}\n"));
+   static_assert(shader.contains("gl_Position"));
+   static_assert(shader.hash() == HashLiteral(static_cast<::std::string_view>(shader)));
+
+   static_assert(::std::same_as<decltype(empty), const decltype(literal_t {u8""})>);
+   static_assert(empty.empty());
+   static_assert(empty == u8"");
+
+   REQUIRE(shader.find("void main()") == 24);
+   REQUIRE(shader.substr(0, 8) == "#version");
+}
+
+TEST_CASE("Literals from raw bytes", "[embed]") {
+   static constexpr unsigned char bytes[] = {'p', 'o', 's'};
+   constexpr auto pos = literal_from_bytes(bytes);
+   static_assert(pos == "pos");
+   static_assert(::std::same_as<decltype(pos), const decltype(literal_t {"pos"})>);
+
+   static constexpr unsigned char utf8[] = {0xC3, 0xA9};
+   static_assert(literal_from_bytes<char8_t>(utf8) == u8"é");
+
+   static constexpr unsigned char terminated[] = {'p', 'o', 's', 0};
+   static constexpr unsigned char nothing[] = {0};
+   static_assert(literal_from_terminated_bytes(terminated) == pos);
+   static_assert(::std::same_as<decltype(literal_from_terminated_bytes(terminated)), decltype(literal_t {"pos"})>);
+   static_assert(::std::same_as<decltype(literal_from_terminated_bytes(nothing)), decltype(literal_t {""})>);
+}
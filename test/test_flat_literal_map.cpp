@@ -0,0 +1,156 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/FlatMap.hpp>
+#include <string>
+#include <memory>
+#include <vector>
+
+using namespace Langulus;
+
+
+///                                                                           
+/// flat_literal_map                                                          
+///                                                                           
+SCENARIO("Testing flat_literal_map", "[map]") {
+   GIVEN("An empty map") {
+      flat_literal_map<8, int> map;
+      REQUIRE(map.empty());
+      REQUIRE(map.size() == 0);
+      REQUIRE(map.begin() == map.end());
+      REQUIRE(not map.contains("AAPL"));
+      REQUIRE(map.find("AAPL") == map.end());
+      REQUIRE(map.erase("AAPL") == 0);
+      REQUIRE_THROWS_AS(map.at("AAPL"), ::std::out_of_range);
+
+      WHEN("Keys are inserted") {
+         REQUIRE(map.try_emplace("AAPL", 1).second);
+         REQUIRE(map.try_emplace(literal_t {"MSFT"}, 2).second);
+         REQUIRE(map.try_emplace(::std::string_view {"GOOG"}, 3).second);
+         REQUIRE(not map.try_emplace("AAPL", 4).second);
+
+         THEN("They can be looked up with any kind of key") {
+            REQUIRE(map.size() == 3);
+            REQUIRE(map.at("AAPL") == 1);
+            REQUIRE(map.at(literal_t {"MSFT"}) == 2);
+            REQUIRE(map.at(::std::string {"GOOG"}) == 3);
+            REQUIRE(map.find("MSFT")->second == 2);
+            REQUIRE(map.find("MSFT")->first == "MSFT");
+            REQUIRE(not map.contains("AMZN"));
+            REQUIRE(not map.contains("AAPL_TOO_LONG"));
+         }
+
+         THEN("They can be overwritten and erased") {
+            map["AAPL"] = 10;
+            map.insert_or_assign("MSFT", 20);
+            REQUIRE(map.at("AAPL") == 10);
+            REQUIRE(map.at("MSFT") == 20);
+            REQUIRE(map.erase("AAPL") == 1);
+            REQUIRE(not map.contains("AAPL"));
+            REQUIRE(map.size() == 2);
+         }
+
+         THEN("Iteration visits each of them once") {
+            int sum = 0;
+            for (auto& [key, value] : map)
+               sum += value;
+            REQUIRE(sum == 6);
+         }
+      }
+
+      WHEN("A key that doesn't fit is inserted") {
+         REQUIRE_THROWS_AS(map["TOO_LONG_KEY"], ::std::length_error);
+         REQUIRE(map.empty());
+      }
+   }
+
+   GIVEN("A map that is grown, churned and copied") {
+      flat_literal_map<16, ::std::string> map;
+      for (int i = 0; i < 5000; ++i) {
+         const auto key = "key" + ::std::to_string(i);
+         map[key] = key;
+      }
+      for (int i = 0; i < 5000; i += 2)
+         map.erase("key" + ::std::to_string(i));
+      for (int i = 5000; i < 7500; ++i) {
+         const auto key = "key" + ::std::to_string(i);
+         map.try_emplace(key, key);
+      }
+
+      const auto copy = map;
+      REQUIRE(map.size() == 5000);
+      REQUIRE(copy.size() == 5000);
+      for (int i = 0; i < 7500; ++i) {
+         const auto key = "key" + ::std::to_string(i);
+         const bool expected = i >= 5000 or i % 2;
+         REQUIRE(map.contains(key) == expected);
+         REQUIRE(copy.contains(key) == expected);
+         if (expected)
+            REQUIRE(copy.at(key) == key);
+      }
+
+      map.clear();
+      REQUIRE(map.empty());
+      REQUIRE(not map.contains("key1"));
+      REQUIRE(copy.contains("key1"));
+   }
+
+   GIVEN("A map with move-only values") {
+      flat_literal_map<8, ::std::unique_ptr<int>> map;
+      map.try_emplace("a", ::std::make_unique<int>(1));
+      map.try_emplace("b", ::std::make_unique<int>(2));
+      auto moved = ::std::move(map);
+      REQUIRE(*moved.at("a") == 1);
+      REQUIRE(*moved.at("b") == 2);
+   }
+}
+
+SCENARIO("Batched lookups in flat_literal_map", "[map]") {
+   GIVEN("A churned map, and keys that are present, missing or too long") {
+      flat_literal_map<16, int> map;
+      for (int i = 0; i < 3000; ++i)
+         map["key" + ::std::to_string(i)] = i;
+      for (int i = 0; i < 3000; i += 3)
+         map.erase("key" + ::std::to_string(i));
+
+      ::std::vector<literal_t<char, 32>> keys;
+      for (int i = 0; i < 4000; ++i)
+         keys.push_back(inplace_literal<char, 32> {"key" + ::std::to_string(i)}.literal());
+      keys.push_back(inplace_literal<char, 32> {"a_key_that_is_too_long"}.literal());
+      keys[5]._data[10] = 'x';
+
+      WHEN("They are all looked up at once") {
+         const auto& constant = map;
+         ::std::vector<decltype(map)::iterator> found(keys.size());
+         ::std::vector<decltype(map)::const_iterator> constFound(keys.size());
+         map.find_batch(keys, found);
+         constant.find_batch(keys, constFound);
+
+         THEN("Results are the same as looking them up one by one") {
+            for (size_t i = 0; i < keys.size(); ++i) {
+               const ::std::string_view key = keys[i];
+               REQUIRE(found[i] == map.find(key));
+               REQUIRE(constFound[i] == constant.find(key));
+            }
+            REQUIRE(found[4]->second == 4);
+            REQUIRE(found[5]->second == 5);
+            REQUIRE(found[6] == map.end());
+            REQUIRE(found.back() == map.end());
+         }
+      }
+   }
+
+   GIVEN("An empty map") {
+      const flat_literal_map<8, int> map;
+      const literal_t<char, 8> keys[] {"a", "b"};
+      decltype(map)::const_iterator found[2];
+      map.find_batch(keys, found);
+      REQUIRE(found[0] == map.end());
+      REQUIRE(found[1] == map.end());
+   }
+}
@@ -0,0 +1,51 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/HashBatch.hpp>
+#include <random>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Random literals of any length, some with garbage past the terminator   
+   template<class T, size_t N>
+   ::std::vector<literal_t<T, N>> RandomLiterals(size_t count) {
+      ::std::mt19937 rng {static_cast<uint32_t>(count + N)};
+      ::std::vector<literal_t<T, N>> result(count);
+      for (auto& s : result) {
+         const size_t length = rng() % (N + 1);
+         for (size_t i = 0; i < length; ++i)
+            s._data[i] = static_cast<T>(1 + rng() % 200);
+         if (length + 1 < N and rng() % 4 == 0)
+            s._data[length + 1] = static_cast<T>('x');
+      }
+      return result;
+   }
+}
+
+
+///                                                                           
+/// hash_batch                                                                
+///                                                                           
+TEMPLATE_TEST_CASE_SIG("Testing hash_batch", "[hash]",
+   ((class T, size_t N), T, N),
+   (char, 4), (char, 8), (char, 16), (char, 32), (char, 64),
+   (char16_t, 4), (char16_t, 8), (char32_t, 4), (wchar_t, 8)
+) {
+   // Not a multiple of any lane count, to exercise the tail too        
+   const auto keys = RandomLiterals<T, N>(1003);
+   ::std::vector<uint64_t> hashes(keys.size());
+   hash_batch(keys, hashes);
+
+   for (size_t i = 0; i < keys.size(); ++i) {
+      REQUIRE(hashes[i] == keys[i].hash());
+      REQUIRE(hashes[i] == HashLiteral(static_cast<::std::basic_string_view<T>>(keys[i])));
+   }
+}
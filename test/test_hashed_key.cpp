@@ -0,0 +1,72 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/HashedKey.hpp>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace Langulus;
+
+
+///                                                                           
+/// hashed_key, literal_key, literal_hash, literal_equal                      
+///                                                                           
+SCENARIO("Testing precomputed hashes", "[hash]") {
+   using Key = hashed_key<"config.timeout">;
+   static_assert(::std::is_empty_v<Key>);
+   static_assert(Key::view == "config.timeout");
+   static_assert(Key::hash == literal_t {"config.timeout"}.hash());
+   static_assert(Key::hash == HashLiteral(::std::string_view {"config.timeout"}));
+
+   constexpr literal_key key {"config.timeout"};
+   static_assert(key.hash == Key::hash);
+   static_assert(literal_key {Key {}}.hash == Key::hash);
+
+   constexpr literal_hash hash;
+   const ::std::string string = "config.timeout";
+   REQUIRE(hash(Key {}) == hash(string));
+   REQUIRE(hash(key) == hash(string));
+   REQUIRE(hash(::std::string_view {string}) == hash(string));
+   REQUIRE(hash(string.c_str()) == hash(string));
+   REQUIRE(hash("config.timeout") == hash(string));
+   REQUIRE(hash(literal_t {"config.timeout"}) == hash(string));
+   REQUIRE(hash(u"config.timeout") == hash(hashed_key<u"config.timeout"> {}));
+   REQUIRE(hash(Key {}) != hash(hashed_key<"config.retries"> {}));
+
+   constexpr literal_equal equal;
+   static_assert(equal(Key {}, key));
+   static_assert(equal(Key {}, literal_t {"config.timeout"}));
+   static_assert(not equal(Key {}, "config.retries"));
+   REQUIRE(equal(string, Key {}));
+
+   GIVEN("A std::unordered_map with transparent hashing") {
+      ::std::unordered_map<::std::string, int, literal_hash, literal_equal> map {
+         {"config.timeout", 30},
+         {"config.retries", 3}
+      };
+
+      THEN("It can be searched with any kind of key, without allocating") {
+         REQUIRE(map.find(Key {})->second == 30);
+         REQUIRE(map.find(hashed_key<"config.retries"> {})->second == 3);
+         REQUIRE(map.find(key)->second == 30);
+         REQUIRE(map.find(::std::string_view {"config.retries"})->second == 3);
+         REQUIRE(map.find(literal_t {"config.retries"})->second == 3);
+         REQUIRE(map.contains("config.timeout"));
+         REQUIRE(not map.contains(hashed_key<"config.missing"> {}));
+         REQUIRE(map.count(literal_key {"config.missing"}) == 0);
+      }
+   }
+
+   GIVEN("A std::unordered_set of string views") {
+      ::std::unordered_set<::std::string_view, literal_hash, literal_equal> set {
+         "a", "b", "config.timeout"
+      };
+      REQUIRE(set.contains(Key {}));
+      REQUIRE(not set.contains(hashed_key<"c"> {}));
+   }
+}
@@ -0,0 +1,144 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Inplace.hpp>
+#include <string>
+
+using namespace Langulus;
+
+
+///                                                                           
+/// inplace_literal                                                           
+///                                                                           
+SCENARIO("Testing inplace_literal", "[inplace]") {
+   static_assert(CT::LiteralString<inplace_literal<char, 16>>);
+   static_assert(sizeof(inplace_literal<char, 16>) <= 32);
+
+   GIVEN("A default-constructed inplace_literal") {
+      inplace_literal<char, 16> str;
+      REQUIRE(not str);
+      REQUIRE(str.size() == 0);
+      REQUIRE(str.empty());
+      REQUIRE(str == "");
+      REQUIRE(str.capacity() == 16);
+
+      WHEN("Filled from runtime data") {
+         ::std::string wire = "AAPL";
+         str = ::std::string_view {wire};
+
+         REQUIRE(str);
+         REQUIRE(str.size() == 4);
+         REQUIRE(str == "AAPL");
+         REQUIRE(str == literal_t {"AAPL"});
+         REQUIRE(str.literal() == literal_t {"AAPL"});
+         REQUIRE(static_cast<::std::string_view>(str) == "AAPL");
+      }
+
+      WHEN("Characters are pushed and popped") {
+         str.push_back('a');
+         str.push_back('b');
+         str += 'c';
+         REQUIRE(str == "abc");
+         str.pop_back();
+         REQUIRE(str == "ab");
+         REQUIRE(str.size() == 2);
+         REQUIRE(str._data[2] == '\0');
+      }
+
+      WHEN("Appended past the capacity with the truncating policy") {
+         str.append("0123456789");
+         str += "0123456789";
+         REQUIRE(str.full());
+         REQUIRE(str.size() == 16);
+         REQUIRE(str == "0123456789012345");
+         str.push_back('x');
+         REQUIRE(str == "0123456789012345");
+      }
+
+      WHEN("Resized and cleared") {
+         str.resize(3, 'z');
+         REQUIRE(str == "zzz");
+         str.resize(1);
+         REQUIRE(str == "z");
+         REQUIRE(str._data[1] == '\0');
+         str.clear();
+         REQUIRE(str.empty());
+         REQUIRE(str._data[0] == '\0');
+      }
+   }
+
+   GIVEN("An inplace_literal with the throwing policy") {
+      inplace_literal<char, 4, Overflow::Throw> str = "abcd";
+      REQUIRE(str == "abcd");
+      REQUIRE_THROWS_AS(str.push_back('e'), ::std::length_error);
+      REQUIRE_THROWS_AS(str = ::std::string_view {"abcde"}, ::std::length_error);
+      REQUIRE(str == "abcd");
+   }
+
+   GIVEN("Contents that are later overwritten with shorter ones") {
+      inplace_literal<char, 16> str = "a long string";
+      str = "short";
+
+      THEN("The tail is zeroed, just like in a compile-time literal_t") {
+         constexpr literal_t<char, 16> expected = "short";
+         REQUIRE(str._data == expected._data);
+         REQUIRE(str.literal().size() == 5);
+      }
+   }
+
+   GIVEN("Contents that are assigned a part of themselves") {
+      inplace_literal<char, 16> str = "abcdef";
+      str.assign(static_cast<::std::string_view>(str).substr(1));
+      REQUIRE(str == "bcdef");
+      REQUIRE(str.size() == 5);
+      REQUIRE(str._data[5] == '\0');
+
+      str = static_cast<::std::string_view>(str).substr(0, 2);
+      REQUIRE(str == "bc");
+      REQUIRE(str._data[2] == '\0');
+
+      str = static_cast<::std::string_view>(str);
+      REQUIRE(str == "bc");
+
+      constexpr auto shifted = [] {
+         inplace_literal<char, 8> r = "abc";
+         r = static_cast<::std::string_view>(r).substr(1);
+         return r;
+      }();
+      STATIC_REQUIRE(shifted == "bc");
+   }
+
+   GIVEN("Equal runtime and compile-time strings") {
+      constexpr literal_t<char, 16> compiled = "BRK.B";
+      const inplace_literal<char, 16> runtime {::std::string {"BRK.B"}};
+
+      THEN("They compare, hash and search identically") {
+         REQUIRE(runtime == compiled);
+         REQUIRE(compiled == runtime);
+         REQUIRE(((runtime <=> compiled) == 0));
+         REQUIRE(runtime < literal_t {"BRK.C"});
+         REQUIRE(::std::hash<inplace_literal<char, 16>> {}(runtime)
+              == ::std::hash<literal_t<char, 16>> {}(compiled));
+         REQUIRE(runtime.find('.') == compiled.find('.'));
+         REQUIRE(runtime.rfind("B") == compiled.rfind("B"));
+         REQUIRE(runtime.starts_with("BRK"));
+         REQUIRE(runtime.ends_with(".B"));
+      }
+   }
+
+   GIVEN("A constexpr inplace_literal") {
+      constexpr auto str = [] {
+         inplace_literal<char16_t, 8> r = u"ab";
+         r.push_back(u'c');
+         r.append(u"de");
+         return r;
+      }();
+      STATIC_REQUIRE(str.size() == 5);
+      STATIC_REQUIRE(str == u"abcde");
+   }
+}
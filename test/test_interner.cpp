@@ -0,0 +1,95 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Interner.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Interned during static initialization, before intern<"...">() had a    
+   /// chance to register anything                                            
+   const interned earlyRuntime = intern("topic.early");
+   const interned earlyLiteral = intern<"topic.literal">();
+}
+
+
+///                                                                           
+/// interned                                                                  
+///                                                                           
+SCENARIO("Testing the string interner", "[interner]") {
+   GIVEN("Compile-time and runtime strings") {
+      const ::std::string runtime = "topic.prices";
+      const auto a = intern<"topic.prices">();
+      const auto b = intern(runtime);
+      const auto c = intern(::std::string_view {"topic.prices"});
+
+      THEN("They get the same handles, compared as integers") {
+         REQUIRE(a == b);
+         REQUIRE(b == c);
+         REQUIRE(a.id() == b.id());
+         REQUIRE(a.view() == runtime);
+         REQUIRE(a.c_str() == b.c_str());
+         REQUIRE(a.hash() == literal_t {"topic.prices"}.hash());
+         REQUIRE(::std::hash<interned> {}(a) == ::std::hash<literal_t<char, 16>> {}("topic.prices"));
+         REQUIRE(find_interned(runtime) == a);
+      }
+
+      THEN("Different strings get different handles") {
+         REQUIRE(a != intern<"topic.trades">());
+         REQUIRE(intern("topic.trades") == intern<"topic.trades">());
+         REQUIRE(not find_interned("topic.never_interned"));
+         REQUIRE(interned {} != intern(""));
+         REQUIRE(intern("").view().empty());
+      }
+
+      THEN("Strings interned during static initialization agree too") {
+         REQUIRE(earlyRuntime == intern<"topic.early">());
+         REQUIRE(earlyLiteral == intern("topic.literal"));
+      }
+   }
+
+   GIVEN("More strings than fit in the root table") {
+      ::std::vector<interned> handles;
+      for (int i = 0; i < 20000; ++i)
+         handles.push_back(intern("field" + ::std::to_string(i)));
+
+      for (int i = 0; i < 20000; ++i) {
+         const auto key = "field" + ::std::to_string(i);
+         REQUIRE(handles[i].view() == key);
+         REQUIRE(find_interned(key) == handles[i]);
+         REQUIRE(intern(key) == handles[i]);
+      }
+   }
+
+   GIVEN("Many threads interning the same strings at once") {
+      constexpr int Threads = 8;
+      constexpr int Strings = 5000;
+      ::std::vector<::std::vector<interned>> results(Threads);
+      {
+         ::std::vector<::std::jthread> pool;
+         for (int t = 0; t < Threads; ++t) {
+            pool.emplace_back([&results, t] {
+               for (int i = 0; i < Strings; ++i)
+                  results[t].push_back(intern("race" + ::std::to_string((i * 7 + t) % Strings)));
+            });
+         }
+      }
+
+      for (int t = 0; t < Threads; ++t) {
+         for (int i = 0; i < Strings; ++i) {
+            const auto key = "race" + ::std::to_string((i * 7 + t) % Strings);
+            REQUIRE(results[t][i].view() == key);
+            REQUIRE(results[t][i] == find_interned(key));
+         }
+      }
+   }
+}
@@ -0,0 +1,56 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Only the lean header - checks that it is enough for literal_t template    
+/// arguments, comparisons and all of the members on its own                  
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Core.hpp>
+
+using namespace Langulus;
+
+namespace
+{
+   template<literal_t NAME>
+   struct Tag {
+      static constexpr auto name = NAME;
+   };
+}
+
+
+///                                                                           
+/// Literal/Core.hpp                                                          
+///                                                                           
+TEST_CASE("Using literal_t with only the core header", "[core]") {
+   static_assert(::std::same_as<decltype(Tag<"pos">::name), const literal_t<char, 4>>);
+   static_assert(::std::same_as<decltype(Tag<5>::name), const literal_t<int, 0>>);
+   static_assert(CT::LiteralString<decltype(Tag<u"pos">::name)>);
+   static_assert(CT::LiteralValue<decltype(Tag<5>::name)>);
+
+   static_assert(Tag<"pos">::name == "pos");
+   static_assert(Tag<"pos">::name != "vel");
+   static_assert(Tag<"pos">::name == literal_t<char, 16> {"pos"});
+   static_assert(Tag<"pos">::name == ::std::string_view {"pos"});
+   static_assert(Tag<"pos">::name.size() == 3);
+   static_assert(Tag<"">::name.empty());
+   static_assert(Tag<5>::name == literal_t {5});
+   static_assert(Tag<"GET">::name.as_integer() == literal_t {"GET"}.as_integer());
+
+   literal_t<char, 16> name {"position"};
+   REQUIRE(name == "position");
+   REQUIRE(name != Tag<"pos">::name);
+   REQUIRE(static_cast<::std::string_view>(name) == "position");
+
+   // Every member is in the core, only free functions are opt-in       
+   static_assert(Tag<"position">::name.find("it") == 3);
+   static_assert(Tag<"position">::name.substr(0, 3) == "pos");
+   static_assert(Tag<"pos">::name.starts_with("po"));
+   static_assert(Tag<"pos">::name.compare("vel") < 0);
+   static_assert(Tag<"pos">::name.hash() == literal_t<char, 16> {"pos"}.hash());
+   name += "al";
+   REQUIRE(name == "positional");
+}
@@ -0,0 +1,110 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Pack.hpp>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Names of the form "f0", "f1", ... for building big packs               
+   template<size_t I>
+   consteval literal_t<char, 8> Numbered() {
+      literal_t<char, 8> name {"f"};
+      size_t digits = 1;
+      for (auto i = I; i >= 10; i /= 10)
+         ++digits;
+      for (auto i = I, d = digits; d; i /= 10, --d)
+         name._data[d] = static_cast<char>('0' + i % 10);
+      return name;
+   }
+
+   template<size_t...I>
+   consteval auto NumberedPack(::std::index_sequence<I...>) {
+      return literal_pack<Numbered<I>()...> {};
+   }
+
+   using Big = decltype(NumberedPack(::std::make_index_sequence<1024> {}));
+}
+
+
+///                                                                           
+/// pack_index_of, pack_contains, pack_unique                                 
+///                                                                           
+TEST_CASE("Searching literal packs", "[pack]") {
+   static_assert(pack_index_of<"x", "a", "b", "x"> == 2);
+   static_assert(pack_index_of<"a", "a", "b", "a"> == 0);
+   static_assert(pack_index_of<"z", "a", "b", "x"> == literal_pack<>::npos);
+   static_assert(pack_index_of<"x"> == literal_pack<>::npos);
+
+   // Capacity doesn't matter, only contents                                  
+   static_assert(pack_index_of<literal_t<char, 16> {"b"}, "a", "b"> == 1);
+   static_assert(pack_contains<"b", "a", "b">);
+   static_assert(not pack_contains<"ab", "a", "b">);
+   static_assert(not pack_contains<"", "a", "b">);
+   static_assert(pack_contains<"", "a", "">);
+
+   static_assert(pack_unique<"a", "b", "x">);
+   static_assert(not pack_unique<"a", "b", "a">);
+   static_assert(pack_unique<>);
+
+   using P = literal_pack<u"left", u"right">;
+   static_assert(P::size == 2);
+   static_assert(P::index_of<u"right"> == 1);
+   static_assert(P::at<0> == u"left");
+   static_assert(::std::same_as<decltype(P::at<1>), const literal_t<char16_t, 8>>);
+
+   static_assert(Big::size == 1024);
+   static_assert(Big::at<1000> == "f1000");
+   static_assert(Big::index_of<"f0"> == 0);
+   static_assert(Big::index_of<"f777"> == 777);
+   static_assert(Big::index_of<"f1023"> == 1023);
+   static_assert(not Big::contains<"f1024">);
+   static_assert(Big::unique);
+}
+
+///                                                                           
+/// pack_sort, pack_set_equal                                                 
+///                                                                           
+TEST_CASE("Ordering literal packs", "[pack]") {
+   static_assert(::std::same_as<pack_sort<"b", "c", "a">, literal_pack<"a", "b", "c">>);
+   static_assert(::std::same_as<pack_sort<"ab", "a", "">, literal_pack<"", "a", "ab">>);
+   static_assert(::std::same_as<pack_sort<>, literal_pack<>>);
+   static_assert(::std::same_as<pack_sort<"b", "a", "b">, literal_pack<"a", "b", "b">>);
+
+   // Literals keep their types                                               
+   static_assert(::std::same_as<
+      pack_sort<literal_t<char, 16> {"b"}, "a">,
+      literal_pack<"a", literal_t<char, 16> {"b"}>
+   >);
+
+   static_assert(pack_set_equal<literal_pack<"a", "b">, literal_pack<"b", "a">>);
+   static_assert(pack_set_equal<literal_pack<"a", "b", "a">, literal_pack<"b", "a">>);
+   static_assert(pack_set_equal<literal_pack<>, literal_pack<>>);
+   static_assert(not pack_set_equal<literal_pack<"a", "b">, literal_pack<"a", "c">>);
+   static_assert(not pack_set_equal<literal_pack<"a">, literal_pack<"a", "c">>);
+
+   using Sorted = decltype([]<size_t...I>(::std::index_sequence<I...>) {
+      return pack_sort<Big::at<Big::size - 1 - I>...> {};
+   }(::std::make_index_sequence<Big::size> {}));
+   static_assert(Sorted::at<0> == "f0");
+   static_assert(Sorted::at<1> == "f1");
+   static_assert(Sorted::at<2> == "f10");
+   static_assert(Sorted::at<Sorted::size - 1> == "f999");
+   static_assert(pack_set_equal<Sorted, Big>);
+   REQUIRE(::std::is_sorted(Sorted::views.begin(), Sorted::views.end()));
+}
+
+TEST_CASE("Pack queries don't hide standard algorithms", "[pack]") {
+   // Found through ADL, despite the using namespace above              
+   ::std::vector<int> numbers {3, 1, 2, 1};
+   sort(numbers.begin(), numbers.end());
+   numbers.erase(unique(numbers.begin(), numbers.end()), numbers.end());
+   REQUIRE(numbers == ::std::vector<int> {1, 2, 3});
+}
\ No newline at end of file
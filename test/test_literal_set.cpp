@@ -0,0 +1,84 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Set.hpp>
+
+using namespace Langulus;
+
+namespace
+{
+   /// A component of the ECS in the Set.hpp example                          
+   template<class SET>
+   struct ComponentImpl {
+      static inline int instances = 0;
+      ComponentImpl() { ++instances; }
+   };
+
+   template<literal_t...C>
+   using Component = ComponentImpl<literal_set_t<C...>>;
+}
+
+
+///                                                                           
+/// literal_set_t                                                             
+///                                                                           
+TEST_CASE("Canonical literal sets", "[set]") {
+   static_assert(::std::same_as<literal_set_t<"vel", "pos">, literal_set<"pos", "vel">>);
+   static_assert(::std::same_as<literal_set_t<"vel", "pos", "vel">, literal_set<"pos", "vel">>);
+   static_assert(::std::same_as<literal_set_t<"a", "a", "a">, literal_set<"a">>);
+   static_assert(::std::same_as<literal_set_t<>, literal_set<>>);
+   static_assert(::std::same_as<literal_set_t<"">, literal_set<"">>);
+
+   // Capacity doesn't matter, only contents                                  
+   static_assert(::std::same_as<literal_set_t<literal_t<char, 64> {"pos"}>, literal_set<"pos">>);
+   static_assert(::std::same_as<
+      literal_set_t<literal_t<char, 64> {"vel"}, "pos", literal_t<char, 8> {"pos"}>,
+      literal_set<"pos", "vel">
+   >);
+
+   using S = literal_set_t<u"right", u"left">;
+   static_assert(S::size == 2);
+   static_assert(S::contains<u"left">);
+   static_assert(not S::contains<u"up">);
+   static_assert(S::pack::at<0> == u"left");
+
+   // One instantiation per logical set                                       
+   Component<"pos", "vel"> a;
+   Component<"vel", "pos"> b;
+   Component<"vel", "pos", "vel"> c;
+   REQUIRE(ComponentImpl<literal_set<"pos", "vel">>::instances == 3);
+}
+
+///                                                                           
+/// set_union, set_intersection, is_subset                                    
+///                                                                           
+TEST_CASE("Literal set operations", "[set]") {
+   using A = literal_set_t<"pos", "vel">;
+   using B = literal_set_t<"vel", "mass">;
+   using E = literal_set_t<>;
+
+   static_assert(::std::same_as<set_union<A, B>, literal_set<"mass", "pos", "vel">>);
+   static_assert(::std::same_as<set_union<A, A>, A>);
+   static_assert(::std::same_as<set_union<A, E>, A>);
+   static_assert(::std::same_as<set_union<E, E>, E>);
+
+   static_assert(::std::same_as<set_intersection<A, B>, literal_set<"vel">>);
+   static_assert(::std::same_as<set_intersection<B, A>, literal_set<"vel">>);
+   static_assert(::std::same_as<set_intersection<A, A>, A>);
+   static_assert(::std::same_as<set_intersection<A, E>, E>);
+   static_assert(::std::same_as<set_intersection<A, literal_set_t<"x">>, E>);
+
+   static_assert(is_subset<literal_set_t<"vel">, A>);
+   static_assert(is_subset<A, A>);
+   static_assert(is_subset<E, A>);
+   static_assert(is_subset<E, E>);
+   static_assert(not is_subset<A, B>);
+   static_assert(not is_subset<A, literal_set_t<"vel">>);
+   static_assert(not is_subset<A, E>);
+   static_assert(is_subset<set_intersection<A, B>, set_union<A, B>>);
+}
@@ -0,0 +1,101 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Sort.hpp>
+#include <random>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Generate random literals, with lots of shared prefixes and duplicates  
+   template<class T, size_t N>
+   ::std::vector<literal_t<T, N>> RandomLiterals(size_t count, uint32_t seed) {
+      ::std::mt19937 rng {seed};
+      ::std::vector<literal_t<T, N>> result(count);
+      for (auto& s : result) {
+         const size_t length = rng() % (N + 1);
+         for (size_t i = 0; i < length; ++i)
+            s._data[i] = static_cast<T>('A' + rng() % 4 + (rng() % 64 == 0 ? 100 : 0));
+      }
+      return result;
+   }
+
+   template<class T, size_t N>
+   bool SortedLikeOperator(const ::std::vector<literal_t<T, N>>& data) {
+      for (size_t i = 1; i < data.size(); ++i) {
+         if ((data[i - 1] <=> data[i]) > 0)
+            return false;
+      }
+      return true;
+   }
+}
+
+
+///                                                                           
+/// radix_sort                                                                
+///                                                                           
+TEMPLATE_TEST_CASE("Testing radix_sort", "[sort]",
+   char, char8_t, char16_t, wchar_t
+) {
+   using T = TestType;
+
+   GIVEN("Random literals with a small capacity") {
+      auto data = RandomLiterals<T, 8>(20000, 1);
+      auto expected = data;
+      ::std::sort(expected.begin(), expected.end(),
+         [](auto& a, auto& b) { return (a <=> b) < 0; });
+
+      radix_sort(data);
+      REQUIRE(SortedLikeOperator(data));
+      REQUIRE(data == expected);
+   }
+
+   GIVEN("Random literals with a big capacity") {
+      auto data = RandomLiterals<T, 32>(20000, 2);
+      auto expected = data;
+      ::std::sort(expected.begin(), expected.end(),
+         [](auto& a, auto& b) { return (a <=> b) < 0; });
+
+      radix_sort(data);
+      REQUIRE(data == expected);
+   }
+
+   GIVEN("Literals with garbage past their terminators") {
+      constexpr T ab[] = {'a', 'b', 0, 'z', 0};
+      constexpr T abz[] = {'a', 'b', 'z', 0, 0};
+      ::std::vector<literal_t<T, 4>> data(200, ab);
+      data.resize(400, abz);
+      ::std::reverse(data.begin(), data.end());
+
+      radix_sort(data);
+      REQUIRE(data.front() == literal_t<T, 4> {ab});
+      REQUIRE(data.back() == literal_t<T, 4> {abz});
+      REQUIRE(data.front()._data[3] == 0);
+   }
+}
+
+SCENARIO("Testing parallel_radix_sort and binary searches", "[sort]") {
+   auto data = RandomLiterals<char, 16>(300000, 3);
+   auto expected = data;
+   radix_sort(expected);
+   parallel_radix_sort(data, 4);
+   REQUIRE(data == expected);
+
+   const literal_t<char, 16> key = "ABCD";
+   const auto first = lower_bound(data, key);
+   const auto last = upper_bound(data, key);
+   const auto range = equal_range(data, key);
+   REQUIRE(first - data.cbegin() == ::std::count_if(data.begin(), data.end(),
+      [&](auto& s) { return s < key; }));
+   REQUIRE(static_cast<size_t>(last - first) == range.size());
+   REQUIRE(static_cast<size_t>(::std::count(data.begin(), data.end(), key)) == range.size());
+   for (auto& s : range)
+      REQUIRE(s == key);
+}
@@ -30,6 +30,15 @@ namespace
    consteval auto LiteralAsTemplateArgument() {
       return SENT_AS_TEMPLATE_ARGUMENT;
    }
+
+   /// Far more characters than the literals in the rest of the tests         
+   template<class T>
+   consteval auto Large() {
+      literal_t<T, 65536> result;
+      for (size_t i = 0; i < 65535; ++i)
+         result.data()[i] = static_cast<T>('a' + i % 26);
+      return result;
+   }
 }
 
 
@@ -241,6 +250,185 @@ TEMPLATE_TEST_CASE("Testing literal strings", "[ct]",
    }
 
    WHEN("Hashed") {
+      REQUIRE(::std::hash<::std::decay_t<decltype(fixedString)>> {}(fixedString)
+           == static_cast<size_t>(HashLiteral(viewString)));
+      STATIC_REQUIRE(fixedString.hash() == HashLiteral(viewString));
+      STATIC_REQUIRE(literal_t<char, 32> {"Test String"}.hash() == fixedString.hash());
+      REQUIRE(fixedString.hash() != literal_t {"Test Strinh"}.hash());
+   }
+}
+
+
+///                                                                           
+/// Short literals, processed in packed form                                  
+///                                                                           
+TEMPLATE_TEST_CASE("Testing packed literals", "[packed]",
+   char, char8_t, char16_t, char32_t
+) {
+   using T = TestType;
+   constexpr T abc[] = {'a', 'b', 'c', 0};
+   constexpr T abd[] = {'a', 'b', 'd', 0};
+   constexpr T ab[] = {'a', 'b', 0};
+   constexpr T garbage[] = {'a', 'b', 0, 'x', 0};
+
+   constexpr literal_t<T, 4> short4 = abc;
+   constexpr literal_t<T, 16> short16 = abc;
+   constexpr literal_t<T, 64> long64 = abc;
+   literal_t<T, 4> withGarbage = garbage;
+
+   WHEN("Sized") {
+      REQUIRE(short4.size() == 3);
+      REQUIRE(short16.size() == 3);
+      REQUIRE(withGarbage.size() == 2);
+      REQUIRE(literal_t<T, 4> {}.size() == 0);
+      REQUIRE(literal_t<T, 4> {{'a', 'b', 'c', 'd', 0}}.size() == 4);
+   }
+
+   WHEN("Compared") {
+      REQUIRE(short4 == short16);
+      REQUIRE(short16 == long64);
+      REQUIRE(short16 != literal_t<T, 16> {abd});
+      REQUIRE(withGarbage == literal_t<T, 4> {ab});
+      REQUIRE(withGarbage != literal_t<T, 4> {abc});
+      STATIC_REQUIRE(short4 == short16);
+   }
+
+   WHEN("Hashed") {
+      REQUIRE(short4.hash() == short16.hash());
+      REQUIRE(short16.hash() == long64.hash());
+      REQUIRE(withGarbage.hash() == literal_t<T, 4> {ab}.hash());
+      REQUIRE(short16.hash() == HashLiteral(::std::basic_string_view<T> {abc}));
+      STATIC_REQUIRE(short4.hash() == long64.hash());
+   }
 
+   WHEN("Checked for prefixes") {
+      REQUIRE(short16.starts_with(::std::basic_string_view<T> {ab}));
+      REQUIRE(short16.starts_with(::std::basic_string_view<T> {abc}));
+      REQUIRE(not short16.starts_with(::std::basic_string_view<T> {abd}));
+      REQUIRE(not withGarbage.starts_with(::std::basic_string_view<T> {garbage, 4}));
+      REQUIRE(short4.starts_with(::std::basic_string_view<T> {}));
    }
+
+   WHEN("Converted to an integer") {
+      if constexpr (sizeof(short4) - sizeof(T) <= Inner::IntegerBytes) {
+         STATIC_REQUIRE(short4.as_integer() == literal_t<T, 4> {abc}.as_integer());
+         REQUIRE(withGarbage.as_integer() == literal_t<T, 4> {ab}.as_integer());
+         REQUIRE(short4.as_integer() != literal_t<T, 4> {abd}.as_integer());
+      }
+   }
+}
+
+SCENARIO("Ordering and switching on packed literals", "[packed]") {
+   const char* words[] = {
+      "", "a", "ab", "abc", "abd", "b", "ba", "\xFF", "zzzzzzzz", "zzzzzzzzz",
+      "abcdefgh", "abcdefghi", "abcdefghijklmnop", "abcdefgh\xFF"
+   };
+
+   const auto make = [](::std::string_view from) {
+      literal_t<char, 16> result;
+      for (size_t i = 0; i < from.size(); ++i)
+         result._data[i] = from[i];
+      return result;
+   };
+
+   for (auto lhs : words) {
+      for (auto rhs : words) {
+         const auto expected = ::std::string_view {lhs} <=> ::std::string_view {rhs};
+         REQUIRE(((make(lhs) <=> make(rhs)) == expected));
+         REQUIRE((make(lhs) == make(rhs)) == (expected == 0));
+      }
+   }
+
+   const auto route = [](const literal_t<char, 8>& method) {
+      switch (method.as_integer()) {
+      case literal_t {"GET"}.as_integer():
+         return 1;
+      case literal_t {"POST"}.as_integer():
+         return 2;
+      default:
+         return 0;
+      }
+   };
+
+   REQUIRE(route("GET") == 1);
+   REQUIRE(route("POST") == 2);
+   REQUIRE(route("PUT") == 0);
+}
+
+SCENARIO("Comparing literals against everything else", "[compare]") {
+   // Either side can be the literal                                          
+   STATIC_REQUIRE(fixedString == carrayString);
+   STATIC_REQUIRE(carrayString == fixedString);
+   STATIC_REQUIRE(fixedString == viewString);
+   STATIC_REQUIRE(viewString == fixedString);
+   STATIC_REQUIRE(fixedString != "Test");
+   STATIC_REQUIRE("Test" != fixedString);
+   REQUIRE(fixedString == cptrString);
+   REQUIRE(cptrString == fixedString);
+   REQUIRE(fixedString == justString);
+   REQUIRE(justString == fixedString);
+
+   STATIC_REQUIRE(fixedString < "Test Strinh");
+   STATIC_REQUIRE("Test Strinh" > fixedString);
+   STATIC_REQUIRE(viewString <= fixedString);
+   STATIC_REQUIRE((fixedString <=> viewString) == 0);
+   REQUIRE(justString >= fixedString);
+
+   // Undefined is the empty string                                           
+   STATIC_REQUIRE(emptyUndefined == "");
+   STATIC_REQUIRE("" == emptyUndefined);
+   STATIC_REQUIRE(emptyUndefined != u"a");
+   STATIC_REQUIRE(::std::string_view {} == emptyUndefined);
+   STATIC_REQUIRE(emptyUndefined != viewString);
+
+   // Values only compare with arrays of their type                           
+   constexpr float values[] {5.5f, 1.0f};
+   STATIC_REQUIRE(fixedValue == values);
+   STATIC_REQUIRE(values == fixedValue);
+   STATIC_REQUIRE(fixedValueChar == literal_t {"a"});
+   STATIC_REQUIRE(fixedValueChar != fixedValue);
+
+   STATIC_REQUIRE(not ::std::equality_comparable_with<decltype(fixedString), int>);
+   STATIC_REQUIRE(not ::std::equality_comparable_with<decltype(fixedString), char>);
+   STATIC_REQUIRE(not ::std::equality_comparable_with<decltype(fixedString), ::std::u16string_view>);
+   STATIC_REQUIRE(not ::std::equality_comparable_with<decltype(fixedValue), ::std::string_view>);
+   STATIC_REQUIRE(not ::std::three_way_comparable_with<decltype(fixedString), literal_t<char16_t, 4>>);
+}
+
+///                                                                           
+/// Large literals go through blocks of characters in constant evaluation,    
+/// that have to give the same results as the runtime paths                   
+///                                                                           
+SCENARIO("Large literals in constant expressions", "[large]") {
+   static constexpr auto text = Large<char>();
+   static constexpr auto wide = Large<char16_t>();
+   STATIC_REQUIRE(text.size() == 65535);
+   STATIC_REQUIRE(wide.size() == 65535);
+   STATIC_REQUIRE(text == Large<char>());
+   STATIC_REQUIRE(wide == Large<char16_t>());
+   STATIC_REQUIRE(text != text.substr(1));
+   STATIC_REQUIRE(text.substr(1) == ::std::string_view {text}.substr(1));
+
+   // Full words only, and a partial last word                            
+   static constexpr auto whole = text.substr(7);
+   static constexpr auto partial = text.substr(3);
+   constexpr auto textHash = text.hash();
+   constexpr auto wholeHash = whole.hash();
+   constexpr auto partialHash = partial.hash();
+   constexpr auto wideHash = wide.hash();
+   REQUIRE(text.hash() == textHash);
+   REQUIRE(whole.hash() == wholeHash);
+   REQUIRE(partial.hash() == partialHash);
+   REQUIRE(wide.hash() == wideHash);
+
+   // Appending to itself, and to the limit of the capacity               
+   constexpr auto twice = [] {
+      auto result = text.substr(32768);
+      result += result;
+      result += "overflow";
+      return result;
+   }();
+   STATIC_REQUIRE(twice.size() == 65536);
+   STATIC_REQUIRE(twice.substr(0, 32767) == twice.substr(32767, 32767));
+   STATIC_REQUIRE(twice.ends_with("ov"));
 }
@@ -0,0 +1,243 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Log.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Log lines without their timestamps                                     
+   ::std::vector<::std::string> Messages(const ::std::string& text) {
+      ::std::vector<::std::string> result;
+      ::std::istringstream lines {text};
+      for (::std::string line; ::std::getline(lines, line); )
+         result.push_back(line.substr(27));
+      return result;
+   }
+
+   enum class Color : uint8_t { Red = 1, Green = 2 };
+}
+
+
+///                                                                           
+/// Formats                                                                   
+///                                                                           
+TEST_CASE("Log formats are checked at compile time", "[log]") {
+   static_assert(Inner::LogPlaceholders("no arguments") == 0);
+   static_assert(Inner::LogPlaceholders("user {} failed login from {}") == 2);
+   static_assert(Inner::LogPlaceholders("{{escaped}} {}") == 1);
+   static_assert(Inner::LogPlaceholders("unmatched {") == -1);
+   static_assert(Inner::LogPlaceholders("unmatched } brace") == -1);
+   static_assert(Inner::LogPlaceholders("{x}") == -1);
+
+   static_assert(Inner::LogKindOf<bool>() == Inner::LogKind::Bool);
+   static_assert(Inner::LogKindOf<char>() == Inner::LogKind::Char);
+   static_assert(Inner::LogKindOf<short>() == Inner::LogKind::Signed);
+   static_assert(Inner::LogKindOf<Color>() == Inner::LogKind::Unsigned);
+   static_assert(Inner::LogKindOf<float>() == Inner::LogKind::Float);
+   static_assert(Inner::LogKindOf<const char*>() == Inner::LogKind::String);
+   static_assert(Inner::LogKindOf<char[4]>() == Inner::LogKind::String);
+   static_assert(Inner::LogKindOf<::std::string>() == Inner::LogKind::String);
+   static_assert(Inner::LogKindOf<literal_t<char, 4>>() == Inner::LogKind::String);
+   static_assert(Inner::LogKindOf<int*>() == Inner::LogKind::Pointer);
+
+   // Same format, different layouts                                    
+   using Ints = Inner::LogSite<"value {}", Inner::LogKind::Signed>;
+   using Floats = Inner::LogSite<"value {}", Inner::LogKind::Float>;
+   static_assert(Ints::id != Floats::id);
+   static_assert(Ints::id == Inner::LogSite<"value {}", Inner::LogKind::Signed>::id);
+}
+
+///                                                                           
+/// log, log_writer                                                           
+///                                                                           
+SCENARIO("Logging with deferred formatting", "[log]") {
+   GIVEN("Messages logged outside of any sink") {
+      log<"dropped {}">(1);
+
+      WHEN("A writer is opened later") {
+         ::std::ostringstream out;
+         { log_writer writer {out}; }
+
+         THEN("Nothing was logged") {
+            REQUIRE(out.str().empty());
+         }
+      }
+   }
+
+   GIVEN("A message written just as the last sink closed") {
+      {
+         ::std::ostringstream out;
+         log_writer writer {out};
+      }
+
+      // Like a thread that saw Enabled() right before the sink closed  
+      using Site = Inner::LogSite<"straggler {}", Inner::LogKind::Signed>;
+      static_cast<void>(&Site::Registered);
+      Inner::Logger::Write(Site::id, int64_t {1});
+
+      WHEN("Another writer is opened later") {
+         ::std::ostringstream out;
+         {
+            log_writer writer {out};
+            log<"fresh">();
+         }
+
+         THEN("It gets only what was logged while it was open") {
+            REQUIRE(Messages(out.str()) == ::std::vector<::std::string> {"fresh"});
+         }
+      }
+   }
+
+   GIVEN("A log writer") {
+      ::std::ostringstream out;
+      {
+         log_writer writer {out};
+         const ::std::string name = "alice";
+         const int value = 42;
+         log<"user {} failed login from {}">(name, "10.0.0.1");
+         log<"{{{}}} {} {} {} {}">(-7, 3u, 2.5, true, 'x');
+         log<"{} {} {}">(Color::Green, static_cast<const char*>(nullptr), literal_t {"lit"});
+         log<"no arguments">();
+         log<"{}">(&value);
+         writer.flush();
+      }
+
+      THEN("Messages are formatted in order, with timestamps") {
+         const auto text = out.str();
+         const auto lines = Messages(text);
+         REQUIRE(lines.size() == 5);
+         REQUIRE(lines[0] == "user alice failed login from 10.0.0.1");
+         REQUIRE(lines[1] == "{-7} 3 2.5 true x");
+         REQUIRE(lines[2] == "2 (null) lit");
+         REQUIRE(lines[3] == "no arguments");
+         REQUIRE(lines[4].starts_with("0x"));
+         REQUIRE(text[4] == '-');
+         REQUIRE(text[26] == ' ');
+      }
+   }
+
+   GIVEN("Many threads logging more than fits in their buffers") {
+      ::std::ostringstream out;
+      {
+         log_writer writer {out, ::std::chrono::milliseconds {1}};
+         ::std::vector<::std::jthread> pool;
+         for (int t = 0; t < 4; ++t) {
+            pool.emplace_back([t] {
+               const ::std::string padding(200, '.');
+               for (int i = 0; i < 10000; ++i)
+                  log<"thread {} message {} {}">(t, i, padding);
+            });
+         }
+      }
+
+      THEN("Nothing is lost, and each thread's messages stay in order") {
+         const auto lines = Messages(out.str());
+         REQUIRE(lines.size() == 40000);
+
+         int next[4] {};
+         bool ordered = true;
+         for (auto& line : lines) {
+            int t, i;
+            REQUIRE(::std::sscanf(line.c_str(), "thread %d message %d", &t, &i) == 2);
+            ordered &= next[t] == i;
+            next[t] = i + 1;
+         }
+         REQUIRE(ordered);
+      }
+   }
+}
+
+///                                                                           
+/// log_recorder, decode_log                                                  
+///                                                                           
+SCENARIO("Logging into binary files, and decoding them", "[log]") {
+   const auto path = ::std::filesystem::temp_directory_path() / "langulus_log.bin";
+
+   GIVEN("A recorded log") {
+      {
+         log_recorder recorder {path};
+         for (int i = 0; i < 3; ++i)
+            log<"request {} took {} ms">(i, i * 0.5);
+         log<"done">();
+      }
+
+      WHEN("Decoded") {
+         ::std::ifstream in {path, ::std::ios::binary};
+         ::std::ostringstream out;
+         const auto count = decode_log(in, out);
+
+         THEN("It reads the same as a log_writer's output") {
+            REQUIRE(count == 4);
+            const auto lines = Messages(out.str());
+            REQUIRE(lines == ::std::vector<::std::string> {
+               "request 0 took 0 ms", "request 1 took 0.5 ms",
+               "request 2 took 1 ms", "done"
+            });
+         }
+      }
+
+      WHEN("Something else is decoded") {
+         ::std::istringstream in {"not a log"};
+         ::std::ostringstream out;
+         REQUIRE_THROWS_AS(decode_log(in, out), ::std::runtime_error);
+      }
+   }
+
+   ::std::filesystem::remove(path);
+}
+
+///                                                                           
+/// Several sinks at once                                                     
+///                                                                           
+SCENARIO("Logging into several sinks at once", "[log]") {
+   const auto path = ::std::filesystem::temp_directory_path() / "langulus_log_fanout.bin";
+
+   GIVEN("Two writers and a recorder, open at the same time") {
+      ::std::ostringstream first, second;
+      {
+         log_writer writer {first, ::std::chrono::milliseconds {1}};
+         log_writer another {second, ::std::chrono::milliseconds {1}};
+         log_recorder recorder {path, ::std::chrono::milliseconds {1}};
+         ::std::vector<::std::jthread> pool;
+         for (int t = 0; t < 4; ++t) {
+            pool.emplace_back([t] {
+               for (int i = 0; i < 5000; ++i)
+                  log<"sink {} message {}">(t, i);
+            });
+         }
+      }
+
+      THEN("Each of them gets every message, exactly once, in order") {
+         ::std::ifstream in {path, ::std::ios::binary};
+         ::std::ostringstream decoded;
+         REQUIRE(decode_log(in, decoded) == 20000);
+
+         const auto expected = Messages(first.str());
+         REQUIRE(expected.size() == 20000);
+         REQUIRE(Messages(second.str()) == expected);
+         REQUIRE(Messages(decoded.str()) == expected);
+
+         int next[4] {};
+         bool ordered = true;
+         for (auto& line : expected) {
+            int t, i;
+            REQUIRE(::std::sscanf(line.c_str(), "sink %d message %d", &t, &i) == 2);
+            ordered &= next[t] == i;
+            next[t] = i + 1;
+         }
+         REQUIRE(ordered);
+      }
+   }
+
+   ::std::filesystem::remove(path);
+}
@@ -0,0 +1,111 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Metrics.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Langulus;
+
+
+///                                                                           
+/// counter, gauge, histogram                                                 
+///                                                                           
+SCENARIO("Testing metrics", "[metrics]") {
+   GIVEN("Metrics named by literals") {
+      using Requests = counter<"test.http.requests.total">;
+      using Connections = gauge<"test.connections">;
+      using Latency = histogram<"test.latency.seconds", ::std::array {0.1, 1.0}>;
+
+      static_assert(Requests::name == "test_http_requests_total");
+      static_assert(counter<"1st.metric-name">::name == "_st_metric_name");
+      static_assert(::std::same_as<Requests, counter<"test.http.requests.total">>);
+
+      WHEN("Counters are incremented from many threads") {
+         const auto before = Requests::value();
+         {
+            ::std::vector<::std::jthread> pool;
+            for (int t = 0; t < 16; ++t) {
+               pool.emplace_back([] {
+                  for (int i = 0; i < 10000; ++i)
+                     Requests::inc();
+               });
+            }
+         }
+         Requests::inc(5);
+
+         THEN("Every increment is counted") {
+            REQUIRE(Requests::value() - before == 160005);
+         }
+      }
+
+      WHEN("Gauges are set and changed") {
+         Connections::set(10);
+         Connections::inc();
+         Connections::add(2.5);
+         Connections::dec();
+         REQUIRE(Connections::value() == 12.5);
+      }
+
+      WHEN("Values are observed") {
+         const auto before = Latency::buckets();
+         Latency::observe(0.05);
+         Latency::observe(0.1);
+         Latency::observe(0.5);
+         Latency::observe(7);
+         const auto after = Latency::buckets();
+
+         THEN("They go in the right buckets, upper bounds inclusive") {
+            REQUIRE(after[0] - before[0] == 2);
+            REQUIRE(after[1] - before[1] == 1);
+            REQUIRE(after[2] - before[2] == 1);
+         }
+      }
+   }
+
+   GIVEN("The Prometheus exporter") {
+      using Exported = counter<"test.exported.total">;
+      using Sizes = histogram<"test.sizes", ::std::array {1.0, 2.5}>;
+      using Temperature = gauge<"test.temperature">;
+      Exported::inc(3);
+      Sizes::observe(0.5);
+      Sizes::observe(2);
+      Sizes::observe(100);
+      Temperature::set(-1.25);
+
+      ::std::ostringstream out;
+      export_prometheus(out);
+      const auto text = out.str();
+
+      REQUIRE(text.find("# TYPE test_exported_total counter\ntest_exported_total 3\n") != text.npos);
+      REQUIRE(text.find("# TYPE test_temperature gauge\ntest_temperature -1.25\n") != text.npos);
+      REQUIRE(text.find(
+         "# TYPE test_sizes histogram\n"
+         "test_sizes_bucket{le=\"1\"} 1\n"
+         "test_sizes_bucket{le=\"2.5\"} 2\n"
+         "test_sizes_bucket{le=\"+Inf\"} 3\n"
+         "test_sizes_sum 102.5\n"
+         "test_sizes_count 3\n") != text.npos);
+
+      // Sorted by name                                                 
+      REQUIRE(text.find("test_exported_total") < text.find("test_sizes"));
+      REQUIRE(text.find("test_sizes") < text.find("test_temperature"));
+
+      THEN("It can write to a file too") {
+         const auto path = ::std::filesystem::temp_directory_path() / "langulus_metrics.prom";
+         REQUIRE(export_prometheus(path));
+         ::std::ifstream file {path};
+         ::std::stringstream contents;
+         contents << file.rdbuf();
+         REQUIRE(contents.str().find("test_exported_total") != ::std::string::npos);
+         ::std::filesystem::remove(path);
+      }
+   }
+}
@@ -0,0 +1,73 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Minify.hpp>
+#include "shader.hpp"
+
+using namespace Langulus;
+
+
+///                                                                           
+/// minify                                                                    
+///                                                                           
+TEST_CASE("Minifying embedded GLSL", "[minify]") {
+   constexpr auto shader = minify<Embedded::shader, Lang::GLSL>();
+   static_assert(shader == "#version 450\nvoid main(){gl_Position=vec4(0.0);}");
+   static_assert(::std::same_as<decltype(shader), const literal_t<char, 64>>);
+   static_assert(shader.size() < Embedded::shader.size());
+
+   REQUIRE(shader.find("//") == shader.npos);
+}
+
+TEST_CASE("Minifying GLSL", "[minify]") {
+   // Preprocessor lines keep their newline, and the space before (     
+   static_assert(minify<"  #define SQUARE(x) ((x) * (x)) // square\n"
+                        "#define ONE (1)\nfloat y = SQUARE(ONE);", Lang::GLSL>()
+      == "#define SQUARE(x) ((x) * (x))\n#define ONE (1)\nfloat y=SQUARE(ONE);");
+
+   // Line continuations, and a directive after code                    
+   static_assert(minify<"int a;\n#if 1 \\\n  && 1\n#endif", Lang::GLSL>()
+      == "int a;\n#if 1\\\n&& 1\n#endif");
+
+   // Operators that would join, and comments between tokens            
+   static_assert(minify<"a = b - -c; d = e / /* x */ *f;", Lang::GLSL>()
+      == "a=b- -c;d=e/ *f;");
+   static_assert(minify<"uniform/**/vec4 color;", Lang::GLSL>() == "uniform vec4 color;");
+   static_assert(minify<"float x; /* unterminated", Lang::GLSL>() == "float x;");
+
+   // Numbers that start with a dot keep the space after a word         
+   static_assert(minify<"return .5;\nfloat y = x * .25 + v .x;", Lang::GLSL>()
+      == "return .5;float y=x* .25+v.x;");
+
+   // Wide characters too                                               
+   static_assert(minify<u"  void   main ( ) { }  ", Lang::GLSL>() == u"void main(){}");
+}
+
+TEST_CASE("Minifying SQL", "[minify]") {
+   constexpr auto query = minify<
+      "-- Find users by name\n"
+      "SELECT id, \"full  name\"\n"
+      "  FROM users /* all of them */\n"
+      " WHERE name = 'a -- b'  AND  age > - -1", Lang::SQL>();
+   static_assert(query == "SELECT id,\"full  name\" FROM users WHERE name='a -- b' AND age> - -1");
+
+   // Escaped quotes, and prefixed strings                              
+   static_assert(minify<"SELECT 'it''s' ,  E '\\n'", Lang::SQL>() == "SELECT 'it''s',E '\\n'");
+   static_assert(minify<"", Lang::SQL>() == "");
+   static_assert(minify<"SELECT .5,  a . b", Lang::SQL>() == "SELECT .5,a.b");
+}
+
+TEST_CASE("Minifying JSON", "[minify]") {
+   constexpr auto json = minify<R"({
+      // Settings
+      "name": "a  \" // b",
+      "list": [ 1, -2, true, null ],
+      "nested": { "x": 0.5e-3 }
+   })", Lang::JSON>();
+   static_assert(json == R"({"name":"a  \" // b","list":[1,-2,true,null],"nested":{"x":0.5e-3}})");
+}
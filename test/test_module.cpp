@@ -0,0 +1,52 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+/// Built only with LANGULUS_OPTION_MODULE - checks that everything the       
+/// header offers is reachable through the module, too                        
+///                                                                           
+#include <catch2/catch.hpp>
+#include <functional>
+#include <string_view>
+import Langulus.Literal;
+
+using namespace Langulus;
+
+namespace
+{
+   template<literal_t NAME>
+   consteval auto Name() {
+      return NAME;
+   }
+}
+
+
+///                                                                           
+/// import Langulus.Literal                                                   
+///                                                                           
+TEST_CASE("Using literal_t through the module", "[module]") {
+   constexpr literal_t name = "Test String";
+   static_assert(CT::LiteralString<decltype(name)>);
+   static_assert(::std::same_as<decltype(name), const literal_t<char, 16>>);
+   static_assert(Name<"Test">() == "Test");
+   static_assert(name == ::std::string_view {"Test String"});
+   static_assert(name != "Test");
+   static_assert(name < literal_t {"Tests"});
+   static_assert(name.find("String") == 5);
+   static_assert(literal_t {"Test"} + " String" == name);
+   static_assert(name.hash() == HashLiteral(::std::string_view {"Test String"}));
+
+   constexpr literal_t value = 5.5f;
+   static_assert(CT::LiteralValue<decltype(value)>);
+   static_assert(value == literal_t {5.5f});
+
+   auto a = literal_t {"a"};
+   auto b = literal_t {"b"};
+   ::std::swap(a, b);
+   REQUIRE(a == "b");
+   REQUIRE(b == "a");
+   REQUIRE(::std::hash<literal_t<char, 2>> {}(a) == a.hash());
+}
@@ -0,0 +1,163 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/NamedTuple.hpp>
+#include <stdexcept>
+#include <string>
+
+using namespace Langulus;
+
+namespace
+{
+   using Point = named_tuple<
+      field<"x", float>,
+      field<"y", float>,
+      field<"name", literal_t<char, 16>>
+   >;
+
+   /// Throws when copied while armed                                       
+   struct Thrower {
+      static inline bool armed = false;
+
+      Thrower() = default;
+      Thrower(const Thrower&) {
+         if (armed)
+            throw ::std::runtime_error {"armed"};
+      }
+      Thrower(Thrower&&) noexcept = default;
+      bool operator == (const Thrower&) const = default;
+   };
+
+   struct PlainPoint {
+      float x;
+      float y;
+      literal_t<char, 16> name;
+   };
+}
+
+
+///                                                                           
+/// named_tuple                                                               
+///                                                                           
+TEST_CASE("Named tuples", "[named_tuple]") {
+   static_assert(Point::size == 3);
+   static_assert(Point::index_of<"x"> == 0);
+   static_assert(Point::index_of<"name"> == 2);
+   static_assert(Point::contains<"y">);
+   static_assert(not Point::contains<"z">);
+   static_assert(::std::same_as<Point::type_at<2>, literal_t<char, 16>>);
+
+   // Laid out like a plain struct                                      
+   static_assert(sizeof(Point) == sizeof(PlainPoint));
+
+   constexpr Point p {1, 2, "origin"};
+   static_assert(get<"x">(p) == 1);
+   static_assert(get<"y">(p) == 2);
+   static_assert(get<"name">(p) == "origin");
+   static_assert(p == Point {1, 2, "origin"});
+   static_assert(p != Point {1, 3, "origin"});
+
+   Point q;
+   REQUIRE(get<"x">(q) == 0);
+   REQUIRE(get<"name">(q).empty());
+   get<"x">(q) = 5;
+   get<"name">(q) = "moved";
+   REQUIRE(get<"x">(q) == 5);
+   REQUIRE(get<"name">(::std::move(q)) == "moved");
+
+   auto [x, y, name] = p;
+   REQUIRE(x == 1);
+   REQUIRE(y == 2);
+   REQUIRE(name == "origin");
+
+   // Same field types, told apart by name only                         
+   named_tuple<field<"a", ::std::string>, field<"b", ::std::string>> strings {"first", "second"};
+   REQUIRE(get<"a">(strings) == "first");
+   REQUIRE(get<"b">(strings) == "second");
+}
+
+///                                                                           
+/// named_columns                                                             
+///                                                                           
+TEST_CASE("Named columns", "[named_tuple]") {
+   named_columns<field<"x", float>, field<"y", float>, field<"id", int>> points;
+   REQUIRE(points.empty());
+
+   for (int i = 0; i < 1000; ++i)
+      points.push_back(static_cast<float>(i), static_cast<float>(i * 2), i);
+   points.push_back({-1, -2, -3});
+
+   REQUIRE(points.size() == 1001);
+   REQUIRE(points.capacity() >= 1001);
+
+   SECTION("Columns are contiguous and aligned") {
+      auto xs = get<"x">(points);
+      auto ids = points.column<"id">();
+      REQUIRE(xs.size() == 1001);
+      REQUIRE(reinterpret_cast<uintptr_t>(xs.data()) % points.alignment == 0);
+      REQUIRE(reinterpret_cast<uintptr_t>(ids.data()) % points.alignment == 0);
+
+      float sum = 0;
+      for (float x : xs)
+         sum += x;
+      REQUIRE(sum == 499500 - 1);
+
+      for (float& y : get<"y">(points))
+         y = 0;
+      REQUIRE(points.at<"y">(10) == 0);
+      REQUIRE(points.at<"x">(10) == 10);
+   }
+
+   SECTION("Rows are named tuples") {
+      REQUIRE(points[7] == decltype(points)::row_type {7, 14, 7});
+      REQUIRE(get<"id">(points[1000]) == -3);
+   }
+
+   SECTION("Copied, moved and cleared") {
+      auto copy = points;
+      auto moved = ::std::move(points);
+      REQUIRE(copy.size() == 1001);
+      REQUIRE(moved.size() == 1001);
+      REQUIRE(points.empty());
+      REQUIRE(copy[500] == moved[500]);
+
+      copy.clear();
+      REQUIRE(copy.empty());
+      copy.push_back(1, 2, 3);
+      REQUIRE(get<"id">(copy[0]) == 3);
+   }
+
+   SECTION("Non-trivial columns") {
+      named_columns<field<"name", ::std::string>, field<"score", double>> scores;
+      for (int i = 0; i < 100; ++i)
+         scores.push_back("player " + ::std::to_string(i) + " with a long name", i * 0.5);
+      REQUIRE(scores.at<"name">(42) == "player 42 with a long name");
+      REQUIRE(scores.at<"score">(42) == 21);
+   }
+
+   SECTION("Rows made of the container's own elements") {
+      named_columns<field<"name", ::std::string>, field<"id", int>> names;
+      names.push_back("a name long enough to be on the heap", 1);
+      // Grows a few times, while the arguments refer into old columns  
+      for (int i = 1; i < 100; ++i)
+         names.push_back(names.at<"name">(i - 1), names.at<"id">(i - 1) + 1);
+      REQUIRE(names.at<"name">(99) == "a name long enough to be on the heap");
+      REQUIRE(names.at<"id">(99) == 100);
+   }
+
+   SECTION("A column that throws leaves the others as they were") {
+      named_columns<field<"name", ::std::string>, field<"thrower", Thrower>> rows;
+      rows.push_back("first, and long enough to be on the heap", Thrower {});
+      Thrower::armed = true;
+      REQUIRE_THROWS_AS(rows.push_back("second, and long enough to be on the heap", Thrower {}), ::std::runtime_error);
+      Thrower::armed = false;
+      REQUIRE(rows.size() == 1);
+      rows.push_back("third", Thrower {});
+      REQUIRE(rows.at<"name">(1) == "third");
+   }
+}
@@ -0,0 +1,101 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Reflect.hpp>
+#include <Langulus/Literal/Interner.hpp>
+
+using namespace Langulus;
+
+namespace Reflected
+{
+   struct Widget {};
+   enum class Color : uint8_t { Red = 1, Green = 2, Blue = 200 };
+   enum Plain { Negative = -3, Next, Far = 100 };
+   enum class Empty : int {};
+}
+
+template<>
+struct Langulus::enum_range<Reflected::Plain> {
+   static constexpr int64_t min = -8;
+   static constexpr int64_t max = 120;
+};
+
+
+///                                                                           
+/// type_name, enum_name                                                      
+///                                                                           
+TEST_CASE("Names of types and enumerators at compile time", "[reflect]") {
+   using namespace Reflected;
+
+   static_assert(type_name<Widget>() == "Reflected::Widget");
+   static_assert(type_name<int>() == "int");
+   static_assert(type_name<Color>() == "Reflected::Color");
+
+   // Same type as the literal of the same text                         
+   static_assert(::std::same_as<decltype(type_name<int>()), decltype(literal_t {"int"})>);
+   static_assert(::std::same_as<decltype(type_name<Widget>()), decltype(literal_t {"Reflected::Widget"})>);
+
+   static_assert(enum_name<Color::Blue>() == "Blue");
+   static_assert(enum_name<Color, Color::Red>() == "Red");
+   static_assert(enum_name<Plain::Negative>() == "Negative");
+   static_assert(enum_name<static_cast<Color>(3)>().empty());
+
+   // Interned straight from static storage                             
+   static_assert(type_name_v<Widget> == "Reflected::Widget");
+   REQUIRE(intern<type_name<Widget>()>() == intern("Reflected::Widget"));
+   REQUIRE(intern<type_name<Widget>()>().c_str() == intern<type_name_v<Widget>>().c_str());
+}
+
+///                                                                           
+/// enum_values, enum_names, enum_name(value)                                 
+///                                                                           
+TEST_CASE("Enumerators within a range", "[reflect]") {
+   using namespace Reflected;
+
+   static_assert(enum_values<Color> == ::std::array {Color::Red, Color::Green, Color::Blue});
+   static_assert(enum_names<Color> == ::std::array<::std::string_view, 3> {"Red", "Green", "Blue"});
+   static_assert(enum_values<Plain> == ::std::array {Negative, Next, Far});
+   static_assert(enum_values<Empty>.empty());
+
+   static_assert(enum_name(Color::Green) == "Green");
+   static_assert(enum_name(Next) == "Next");
+   REQUIRE(enum_name(static_cast<Color>(7)).empty());
+   REQUIRE(enum_name(static_cast<Empty>(0)).empty());
+}
+
+///                                                                           
+/// enum_from_string                                                          
+///                                                                           
+TEST_CASE("Enumerators from their names, through a perfect hash", "[reflect]") {
+   using namespace Reflected;
+
+   static_assert(enum_from_string<Color>("Blue") == Color::Blue);
+   static_assert(enum_from_string<Plain>("Far") == Far);
+   static_assert(not enum_from_string<Color>("Purple"));
+   static_assert(not enum_from_string<Empty>("Red"));
+
+   for (auto value : enum_values<Color>)
+      REQUIRE(enum_from_string<Color>(enum_name(value)) == value);
+   for (auto value : enum_values<Plain>)
+      REQUIRE(enum_from_string<Plain>(enum_name(value)) == value);
+
+   REQUIRE_FALSE(enum_from_string<Color>(""));
+   REQUIRE_FALSE(enum_from_string<Color>("red"));
+   REQUIRE_FALSE(enum_from_string<Color>("Reflected::Color::Red"));
+
+   // Every name gets its own slot, even for larger sets                
+   static constexpr ::std::array<::std::string_view, 26> names {
+      "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf",
+      "hotel", "india", "juliett", "kilo", "lima", "mike", "november",
+      "oscar", "papa", "quebec", "romeo", "sierra", "tango", "uniform",
+      "victor", "whiskey", "xray", "yankee", "zulu"
+   };
+   static constexpr Inner::PerfectHash<names.size()> hash {names};
+   for (size_t i = 0; i < names.size(); ++i)
+      REQUIRE(hash.Find(names[i]) == i);
+}
@@ -0,0 +1,87 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Sid.hpp>
+#include <string>
+
+using namespace Langulus;
+
+namespace
+{
+   /// Used in a switch, which needs the IDs to be constants                  
+   int Dispatch(sid64_t id) {
+      switch (id) {
+      case sid<"render.frame">:  return 1;
+      case sid<"render.pass">:   return 2;
+      default:                   return 0;
+      }
+   }
+}
+
+
+///                                                                           
+/// sid, sid32, sid_registry                                                  
+///                                                                           
+SCENARIO("Testing string IDs", "[sid]") {
+   GIVEN("Known answers - these must never change for version 1") {
+      static_assert(SidVersion == 1);
+      static_assert(sid<""> == sid64_t {0x0D4B7B1F9F7469FAull});
+      static_assert(sid<"a"> == sid64_t {0xAC3AE68BC870A276ull});
+      static_assert(sid<"render.frame"> == sid64_t {0xEB6EBD47334696B0ull});
+      static_assert(sid<"network.packet.received"> == sid64_t {0x2BAF384A1D515A0Full});
+      static_assert(sid32<""> == sid32_t {0x923F12E5u});
+      static_assert(sid32<"a"> == sid32_t {0x644A44FDu});
+      static_assert(sid32<"render.frame"> == sid32_t {0xD8282BF7u});
+      static_assert(sid32<"network.packet.received"> == sid32_t {0x36FE6245u});
+   }
+
+   GIVEN("Runtime strings") {
+      const ::std::string name = "render.frame";
+      REQUIRE(make_sid(name) == sid<"render.frame">);
+      REQUIRE(make_sid32(name) == sid32<"render.frame">);
+      REQUIRE(Dispatch(make_sid(name)) == 1);
+      REQUIRE(Dispatch(make_sid("render.pass")) == 2);
+      REQUIRE(Dispatch(make_sid("render.other")) == 0);
+   }
+
+   GIVEN("A compile-time registry") {
+      using Ids = sid_registry<"render.frame", "render.pass", "render.frame">;
+      //using Bad = sid32_registry<"id2727", "id17330">; // shouldn't compile
+      static_assert(Ids::size == 3);
+      static_assert(Ids::get<"render.pass"> == sid<"render.pass">);
+      static_assert(Ids::contains(sid<"render.frame">));
+      static_assert(not Ids::contains(sid<"render.other">));
+      static_assert(Ids::name(sid<"render.pass">) == "render.pass");
+      static_assert(Ids::name(sid<"render.other">).empty());
+      static_assert(sid32_registry<"id2727", "id2728">::size == 2);
+   }
+
+   GIVEN("The runtime registry") {
+   #if lgls_sid_registry
+      THEN("Every sid<...> used anywhere is registered at startup") {
+         REQUIRE(sid_name(sid<"render.frame">) == "render.frame");
+         REQUIRE(sid_name(sid32<"render.frame">) == "render.frame");
+         REQUIRE(sid_name(make_sid("never.used.as.sid")).empty());
+      }
+
+      THEN("Runtime names can be registered, and collisions are caught") {
+         REQUIRE(register_sid("runtime.name") == make_sid("runtime.name"));
+         REQUIRE(sid_name(make_sid("runtime.name")) == "runtime.name");
+         REQUIRE(register_sid<sid32_t>("id2727") == make_sid32("id2727"));
+         REQUIRE(make_sid32("id17330") == make_sid32("id2727"));
+         REQUIRE_THROWS_AS(register_sid<sid32_t>("id17330"), ::std::logic_error);
+         REQUIRE_NOTHROW(register_sid<sid32_t>("id2727"));
+      }
+   #else
+      THEN("It's compiled out, and reverse lookups are empty") {
+         REQUIRE(register_sid("runtime.name") == make_sid("runtime.name"));
+         REQUIRE(sid_name(sid<"render.frame">).empty());
+      }
+   #endif
+   }
+}
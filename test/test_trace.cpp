@@ -0,0 +1,122 @@
+///                                                                           
+/// literal_t                                                                 
+/// Copyright (c) 2025 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#include <catch2/catch.hpp>
+#include <Langulus/Literal/Trace.hpp>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Langulus;
+
+namespace
+{
+   ::std::string ReadFile(const ::std::filesystem::path& path) {
+      ::std::ifstream file {path};
+      ::std::stringstream contents;
+      contents << file.rdbuf();
+      return contents.str();
+   }
+
+   size_t Count(const ::std::string& text, ::std::string_view what) {
+      size_t count = 0;
+      for (auto i = text.find(what); i != text.npos; i = text.find(what, i + 1))
+         ++count;
+      return count;
+   }
+}
+
+
+///                                                                           
+/// trace_scope, trace_file                                                   
+///                                                                           
+SCENARIO("Testing tracing scopes", "[trace]") {
+   static_assert(trace_scope<"db.query">::id == static_cast<uint32_t>(sid32<"db.query">));
+   const auto path = ::std::filesystem::temp_directory_path() / "langulus_trace.json";
+
+   GIVEN("Scopes outside of any trace file") {
+      for (int i = 0; i < 10; ++i)
+         trace_scope<"test.untraced"> scope;
+
+      WHEN("A trace file is opened later") {
+         { trace_file file {path}; }
+
+         THEN("Nothing was recorded") {
+            REQUIRE(Count(ReadFile(path), "test.untraced") == 0);
+         }
+      }
+   }
+
+   GIVEN("Nested scopes on several threads, while a trace file is open") {
+      {
+         trace_file file {path, ::std::chrono::milliseconds {1}};
+         ::std::vector<::std::jthread> pool;
+         for (int t = 0; t < 4; ++t) {
+            pool.emplace_back([] {
+               for (int i = 0; i < 1000; ++i) {
+                  trace_scope<"test.outer"> outer;
+                  trace_scope<"test.\"inner\""> inner;
+               }
+            });
+         }
+         pool.clear();
+         REQUIRE(file.dropped() == 0);
+      }
+
+      THEN("All of them end up in the file, as complete events") {
+         const auto json = ReadFile(path);
+         REQUIRE(json.starts_with(R"({"displayTimeUnit":"ns","traceEvents":[)"));
+         REQUIRE(json.ends_with("\n]}\n"));
+         REQUIRE(Count(json, R"("name":"test.outer","ph":"X")") == 4000);
+         REQUIRE(Count(json, R"("name":"test.\"inner\"","ph":"X")") == 4000);
+         REQUIRE(Count(json, R"("dur":)") == 8000);
+      }
+   }
+
+   GIVEN("A scope that outlives its trace file") {
+      {
+         ::std::optional<trace_scope<"test.straddling">> scope;
+         {
+            trace_file file {path};
+            scope.emplace();
+         }
+         {
+            trace_file next {path};
+            scope.reset();
+         }
+      }
+
+      THEN("It isn't in the next file, with a time before it began") {
+         const auto json = ReadFile(path);
+         REQUIRE(json.ends_with("\n]}\n"));
+         REQUIRE(Count(json, "test.straddling") == 0);
+      }
+   }
+
+   GIVEN("A trace file that is already open") {
+      const auto other = ::std::filesystem::temp_directory_path() / "langulus_trace_other.json";
+      {
+         trace_file file {path};
+         trace_scope<"test.single"> scope;
+
+         THEN("Another one can't be opened, and doesn't touch its path") {
+            REQUIRE_THROWS_AS(trace_file {other}, ::std::logic_error);
+            REQUIRE_THROWS_AS(trace_file {path}, ::std::logic_error);
+            REQUIRE(not ::std::filesystem::exists(other));
+         }
+      }
+
+      THEN("The first one is written in full, and the next one opens") {
+         REQUIRE(ReadFile(path).ends_with("\n]}\n"));
+         REQUIRE_NOTHROW(trace_file {other});
+         ::std::filesystem::remove(other);
+      }
+   }
+
+   ::std::filesystem::remove(path);
+}